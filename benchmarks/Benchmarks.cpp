@@ -6,7 +6,10 @@
 #include <chrono>
 #include <cstddef>
 #include <iostream>
+#include <span>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
 namespace
 {
@@ -49,6 +52,23 @@ int main()
       }
     });
 
+    RunBenchmark("ngin.spawn.batch", [&] {
+      World world;
+      (void)world.SpawnBatch<Transform, Velocity, Tag>(entityCount, [](NGIN::UIntSize index) {
+        return std::tuple {Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f}, Tag{}};
+      });
+    });
+
+    {
+        std::vector<Transform> transforms(entityCount, Transform{0.0f, 0.0f, 0.0f});
+        std::vector<Velocity>  velocities(entityCount, Velocity{1.0f, 2.0f, 3.0f});
+        std::vector<Tag>       tags(entityCount);
+        RunBenchmark("ngin.spawn.batch.columns", [&] {
+          World world;
+          (void)world.SpawnBatch<Transform, Velocity, Tag>(transforms, velocities, tags);
+        });
+    }
+
     RunBenchmark("ngin.query", [&] {
       World world;
       for (int index = 0; index < entityCount; ++index)
@@ -67,6 +87,42 @@ int main()
       });
     });
 
+    RunBenchmark("ngin.query.typed", [&] {
+      World world;
+      for (int index = 0; index < entityCount; ++index)
+      {
+          (void)world.Spawn(Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f});
+      }
+
+      Query<Write<Transform>, Read<Velocity>> query {world};
+      query.ForEachTyped([](Transform& transform, const Velocity& velocity) {
+        transform.x += velocity.x;
+        transform.y += velocity.y;
+        transform.z += velocity.z;
+      });
+    });
+
+    RunBenchmark("ngin.query.columns", [&] {
+      World world;
+      for (int index = 0; index < entityCount; ++index)
+      {
+          (void)world.Spawn(Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f});
+      }
+
+      Query<Write<Transform>, Read<Velocity>> query {world};
+      query.ForChunks([&](const ChunkView& chunk) {
+        const auto transforms = chunk.ColumnMut<Transform>();
+        const auto velocities = chunk.Column<Velocity>();
+        for (std::size_t row = 0; row < transforms.size(); ++row)
+        {
+            transforms[row].x += velocities[row].x;
+            transforms[row].y += velocities[row].y;
+            transforms[row].z += velocities[row].z;
+        }
+        chunk.MarkColumnChanged<Transform>();
+      });
+    });
+
     RunBenchmark("ngin.commands", [&] {
       World world;
       Commands commands;
@@ -77,6 +133,32 @@ int main()
       commands.Flush(world);
     });
 
+    RunBenchmark("ngin.commands.unbatched", [&] {
+      World world;
+      Commands commands;
+      for (int index = 0; index < entityCount; ++index)
+      {
+          commands.Spawn(Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f}, Tag{});
+      }
+      commands.Flush(world, CommandFlushOptions {.BatchConsecutive = false});
+    });
+
+    {
+        // Same buffer every frame: after the first round the arena pages are reused and recording only bumps.
+        World    world;
+        Commands commands;
+        for (int round = 0; round < 2; ++round)
+        {
+            RunBenchmark(round == 0 ? "ngin.commands.record.cold" : "ngin.commands.record.warm", [&] {
+              for (int index = 0; index < entityCount; ++index)
+              {
+                  commands.Spawn(Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f}, Tag{});
+              }
+            });
+            commands.Clear();
+        }
+    }
+
     RunBenchmark("ngin.despawn", [&] {
       World world;
       NGIN::Containers::Vector<EntityId> entities;
@@ -91,6 +173,41 @@ int main()
       }
     });
 
+    RunBenchmark("ngin.despawn.batch", [&] {
+      World world;
+      NGIN::Containers::Vector<EntityId> entities;
+      entities.Reserve(entityCount);
+      for (int index = 0; index < entityCount; ++index)
+      {
+          entities.EmplaceBack(world.Spawn(Transform{float(index), 0.0f, 0.0f}, Tag{}));
+      }
+      world.DespawnBatch(std::span<const EntityId>(entities.data(), entities.Size()));
+    });
+
+    {
+        World world;
+        NGIN::Containers::Vector<EntityId> entities;
+        entities.Reserve(entityCount);
+        for (int index = 0; index < entityCount; ++index)
+        {
+            entities.EmplaceBack(world.Spawn(Transform{float(index), 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f}));
+        }
+        RunBenchmark("ngin.add", [&] {
+          for (NGIN::UIntSize index = 0; index < entities.Size(); ++index)
+          {
+              world.Add<Tag>(entities[index], Tag{});
+          }
+        });
+        RunBenchmark("ngin.remove.bulk", [&] {
+          Query<Read<Transform>, With<Tag>> tagged {world};
+          (void)world.RemoveFromAll<Tag>(tagged);
+        });
+        RunBenchmark("ngin.add.bulk", [&] {
+          Query<Read<Transform>> all {world};
+          (void)world.AddToAll<Tag>(all, Tag{});
+        });
+    }
+
 #if defined(NGIN_ECS_BENCHMARK_WITH_ENTT)
     std::cout << "entt benchmark integration enabled\n";
 #endif
@@ -1,17 +1,22 @@
 #pragma once
 
 #include <NGIN/Primitives.hpp>
+#include <NGIN/Containers/HashMap.hpp>
 #include <NGIN/Containers/Vector.hpp>
 #include <NGIN/Hashing/FNV.hpp>
 #include <NGIN/Memory/SystemAllocator.hpp>
 #include <NGIN/Memory/SmartPointers.hpp>
+#include <NGIN/ECS/ChunkPool.hpp>
+#include <NGIN/ECS/ComponentMask.hpp>
 #include <NGIN/ECS/Entity.hpp>
 #include <NGIN/ECS/TypeRegistry.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <utility>
 
@@ -85,40 +90,66 @@ namespace NGIN::ECS
     class Chunk
     {
     public:
-        explicit Chunk(const NGIN::Containers::Vector<ComponentInfo>& components, NGIN::UIntSize capacity)
-            : m_capacity(capacity)
+        /// @brief Bytes a chunk block needs to hold @p capacity rows of @p components.
+        [[nodiscard]] static NGIN::UIntSize ComputeBlockBytes(const NGIN::Containers::Vector<ComponentInfo>& components,
+                                                              NGIN::UIntSize capacity) noexcept
         {
+            return WalkLayout(components, capacity, [](NGIN::UIntSize, NGIN::UIntSize, NGIN::UIntSize, NGIN::UIntSize) {});
+        }
+
+        /// @param pool Optional block recycler; when null the block comes straight from the system allocator.
+        explicit Chunk(const NGIN::Containers::Vector<ComponentInfo>& components,
+                       NGIN::UIntSize capacity,
+                       ChunkPool* pool = nullptr)
+            : m_pool(pool), m_capacity(capacity)
+        {
+            // Everything that can throw runs before the block is taken: the destructor (which gives it back) does not
+            // run for a constructor that throws, and nothing can fail once the block is held.
             m_columns.Reserve(components.Size());
-            m_entities.Reserve(capacity);
             for (NGIN::UIntSize columnIndex = 0; columnIndex < components.Size(); ++columnIndex)
             {
                 Column column {};
                 column.Info = components[columnIndex];
+                m_columns.EmplaceBack(column);
+            }
 
-                if (!column.Info.IsEmpty)
+            m_blockBytes = ComputeBlockBytes(components, capacity);
+            if (m_pool)
+            {
+                m_block = m_pool->Acquire(m_blockBytes);
+            }
+            else
+            {
+                m_block = static_cast<std::byte*>(m_allocator.Allocate(m_blockBytes, kChunkAlignment));
+                if (!m_block)
                 {
-                    column.Data = m_allocator.Allocate(column.Info.Size * capacity, column.Info.Align);
-                    if (!column.Data)
-                    {
-                        throw std::bad_alloc();
-                    }
+                    throw std::bad_alloc();
                 }
+            }
 
-                column.AddedTicks = static_cast<NGIN::UInt64*>(
-                    m_allocator.Allocate(sizeof(NGIN::UInt64) * capacity, alignof(NGIN::UInt64))
-                );
-                column.ChangedTicks = static_cast<NGIN::UInt64*>(
-                    m_allocator.Allocate(sizeof(NGIN::UInt64) * capacity, alignof(NGIN::UInt64))
-                );
-                if (!column.AddedTicks || !column.ChangedTicks)
+            (void)WalkLayout(components, capacity, [&](NGIN::UIntSize columnIndex,
+                                                       NGIN::UIntSize dataOffset,
+                                                       NGIN::UIntSize addedOffset,
+                                                       NGIN::UIntSize changedOffset) {
+                if (columnIndex == kInvalidIndex)
                 {
-                    throw std::bad_alloc();
+                    m_entities = reinterpret_cast<EntityId*>(m_block + dataOffset);
+                    return;
                 }
-
+                auto& column = m_columns[columnIndex];
+                if (dataOffset != kInvalidIndex)
+                {
+                    column.Data = m_block + dataOffset;
+                }
+                if (addedOffset == kInvalidIndex)
+                {
+                    return;
+                }
+                column.AddedTicks   = reinterpret_cast<NGIN::UInt64*>(m_block + addedOffset);
+                column.ChangedTicks = reinterpret_cast<NGIN::UInt64*>(m_block + changedOffset);
                 std::memset(column.AddedTicks, 0, sizeof(NGIN::UInt64) * capacity);
                 std::memset(column.ChangedTicks, 0, sizeof(NGIN::UInt64) * capacity);
-                m_columns.EmplaceBack(column);
-            }
+            });
         }
 
         Chunk(const Chunk&)            = delete;
@@ -129,32 +160,23 @@ namespace NGIN::ECS
         ~Chunk()
         {
             Reset();
-            for (NGIN::UIntSize columnIndex = 0; columnIndex < m_columns.Size(); ++columnIndex)
+            if (m_pool)
             {
-                auto& column = m_columns[columnIndex];
-                if (column.Data)
-                {
-                    m_allocator.Deallocate(column.Data, column.Info.Size * m_capacity, column.Info.Align);
-                }
-                if (column.AddedTicks)
-                {
-                    m_allocator.Deallocate(column.AddedTicks, sizeof(NGIN::UInt64) * m_capacity, alignof(NGIN::UInt64));
-                }
-                if (column.ChangedTicks)
-                {
-                    m_allocator.Deallocate(column.ChangedTicks,
-                                           sizeof(NGIN::UInt64) * m_capacity,
-                                           alignof(NGIN::UInt64));
-                }
+                m_pool->Release(m_block, m_blockBytes);
+            }
+            else
+            {
+                m_allocator.Deallocate(m_block, m_blockBytes, kChunkAlignment);
             }
         }
 
+        [[nodiscard]] NGIN::UIntSize BlockBytes() const noexcept { return m_blockBytes; }
         [[nodiscard]] NGIN::UIntSize Capacity() const noexcept { return m_capacity; }
         [[nodiscard]] NGIN::UIntSize Count() const noexcept { return m_count; }
         [[nodiscard]] bool HasRoom() const noexcept { return m_count < m_capacity; }
 
         [[nodiscard]] EntityId EntityAt(NGIN::UIntSize row) const noexcept { return m_entities[row]; }
-        [[nodiscard]] const EntityId* Entities() const noexcept { return m_entities.data(); }
+        [[nodiscard]] const EntityId* Entities() const noexcept { return m_entities; }
 
         [[nodiscard]] bool HasColumn(NGIN::UIntSize columnIndex) const noexcept
         {
@@ -188,22 +210,93 @@ namespace NGIN::ECS
 
         [[nodiscard]] NGIN::UInt64 AddedTick(NGIN::UIntSize columnIndex, NGIN::UIntSize row) const noexcept
         {
-            return m_columns[columnIndex].AddedTicks[row];
+            const auto* ticks = m_columns[columnIndex].AddedTicks;
+            return ticks ? ticks[row] : 0;
         }
 
         [[nodiscard]] NGIN::UInt64 ChangedTick(NGIN::UIntSize columnIndex, NGIN::UIntSize row) const noexcept
         {
-            return m_columns[columnIndex].ChangedTicks[row];
+            const auto* ticks = m_columns[columnIndex].ChangedTicks;
+            return ticks ? ticks[row] : 0;
+        }
+
+        /// @brief Upper bound of every added tick ever stored in the column; never lowered by row removal.
+        [[nodiscard]] NGIN::UInt64 MaxAddedTick(NGIN::UIntSize columnIndex) const noexcept
+        {
+            return m_columns[columnIndex].MaxAddedTick;
+        }
+
+        /// @brief Upper bound of every changed tick ever stored in the column; never lowered by row removal.
+        [[nodiscard]] NGIN::UInt64 MaxChangedTick(NGIN::UIntSize columnIndex) const noexcept
+        {
+            return m_columns[columnIndex].MaxChangedTick;
         }
 
         void SetAddedTick(NGIN::UIntSize columnIndex, NGIN::UIntSize row, NGIN::UInt64 tick) noexcept
         {
-            m_columns[columnIndex].AddedTicks[row] = tick;
+            auto& column = m_columns[columnIndex];
+            if (!column.AddedTicks)
+            {
+                return;
+            }
+            column.AddedTicks[row] = tick;
+            column.MaxAddedTick    = (std::max)(column.MaxAddedTick, tick);
         }
 
         void SetChangedTick(NGIN::UIntSize columnIndex, NGIN::UIntSize row, NGIN::UInt64 tick) noexcept
         {
-            m_columns[columnIndex].ChangedTicks[row] = tick;
+            auto& column = m_columns[columnIndex];
+            if (!column.ChangedTicks)
+            {
+                return;
+            }
+            column.ChangedTicks[row] = tick;
+            RaiseMaxTick(column.MaxChangedTick, tick);
+        }
+
+        /// @brief Stamps @p tick as the added tick of rows [firstRow, firstRow + rowCount).
+        void SetAddedTicks(NGIN::UIntSize columnIndex, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount, NGIN::UInt64 tick) noexcept
+        {
+            auto& column = m_columns[columnIndex];
+            if (!column.AddedTicks || rowCount == 0)
+            {
+                return;
+            }
+            std::fill_n(column.AddedTicks + firstRow, rowCount, tick);
+            column.MaxAddedTick = (std::max)(column.MaxAddedTick, tick);
+        }
+
+        /// @brief Stamps @p tick as the changed tick of rows [firstRow, firstRow + rowCount).
+        void SetChangedTicks(NGIN::UIntSize columnIndex, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount, NGIN::UInt64 tick) noexcept
+        {
+            auto& column = m_columns[columnIndex];
+            if (!column.ChangedTicks || rowCount == 0)
+            {
+                return;
+            }
+            std::fill_n(column.ChangedTicks + firstRow, rowCount, tick);
+            RaiseMaxTick(column.MaxChangedTick, tick);
+        }
+
+        /// @brief Copies the added/changed ticks of @p rowCount rows starting at @p sourceRow of @p source's column into
+        /// this chunk's column, raising the summaries to the source's.
+        void CopyTicks(NGIN::UIntSize columnIndex,
+                       NGIN::UIntSize firstRow,
+                       const Chunk& source,
+                       NGIN::UIntSize sourceColumn,
+                       NGIN::UIntSize sourceRow,
+                       NGIN::UIntSize rowCount) noexcept
+        {
+            auto&       column     = m_columns[columnIndex];
+            const auto& fromColumn = source.m_columns[sourceColumn];
+            if (!column.AddedTicks || !fromColumn.AddedTicks)
+            {
+                return;
+            }
+            std::copy_n(fromColumn.AddedTicks + sourceRow, rowCount, column.AddedTicks + firstRow);
+            std::copy_n(fromColumn.ChangedTicks + sourceRow, rowCount, column.ChangedTicks + firstRow);
+            column.MaxAddedTick = (std::max)(column.MaxAddedTick, fromColumn.MaxAddedTick);
+            RaiseMaxTick(column.MaxChangedTick, fromColumn.MaxChangedTick);
         }
 
         [[nodiscard]] NGIN::UIntSize BeginRow(EntityId entityId)
@@ -212,21 +305,43 @@ namespace NGIN::ECS
             {
                 throw std::out_of_range("Chunk is full.");
             }
-            const auto row = m_count;
-            m_entities.EmplaceBack(entityId);
+            const auto row  = m_count;
+            m_entities[row] = entityId;
             ++m_count;
             return row;
         }
 
-        void RollbackNewRow(NGIN::UIntSize row, NGIN::UIntSize constructedColumns) noexcept
+        /// @brief Appends @p rowCount rows for @p entities, which must fit; returns the first new row.
+        [[nodiscard]] NGIN::UIntSize BeginRows(const EntityId* entities, NGIN::UIntSize rowCount)
+        {
+            if (rowCount > m_capacity - m_count)
+            {
+                throw std::out_of_range("Chunk is full.");
+            }
+            const auto firstRow = m_count;
+            std::copy_n(entities, rowCount, m_entities + firstRow);
+            m_count += rowCount;
+            return firstRow;
+        }
+
+        /// @brief Undoes BeginRows(): destroys the first @p constructedColumns columns of the trailing @p rowCount rows.
+        void RollbackNewRows(NGIN::UIntSize firstRow, NGIN::UIntSize rowCount, NGIN::UIntSize constructedColumns) noexcept
         {
             for (NGIN::UIntSize columnIndex = 0; columnIndex < constructedColumns; ++columnIndex)
             {
-                DestroyElement(columnIndex, row);
+                for (NGIN::UIntSize row = firstRow; row < firstRow + rowCount; ++row)
+                {
+                    DestroyElement(columnIndex, row);
+                }
             }
-            if (m_entities.Size() > 0)
+            m_count -= rowCount;
+        }
+
+        void RollbackNewRow(NGIN::UIntSize row, NGIN::UIntSize constructedColumns) noexcept
+        {
+            for (NGIN::UIntSize columnIndex = 0; columnIndex < constructedColumns; ++columnIndex)
             {
-                m_entities.PopBack();
+                DestroyElement(columnIndex, row);
             }
             if (m_count > 0)
             {
@@ -265,22 +380,49 @@ namespace NGIN::ECS
                 result.HadMovedEntity = true;
                 result.MovedEntity    = m_entities[lastRow];
                 result.NewRowIndex    = row;
+                MoveRow(lastRow, row);
+            }
 
-                for (NGIN::UIntSize columnIndex = 0; columnIndex < m_columns.Size(); ++columnIndex)
-                {
-                    MoveElement(columnIndex, lastRow, row);
-                    m_columns[columnIndex].AddedTicks[row]   = m_columns[columnIndex].AddedTicks[lastRow];
-                    m_columns[columnIndex].ChangedTicks[row] = m_columns[columnIndex].ChangedTicks[lastRow];
-                }
-                m_entities[row] = result.MovedEntity;
+            --m_count;
+            return result;
+        }
+
+        /// @brief Destroys @p rows (ascending, no duplicates) and fills the holes they leave with surviving rows from
+        /// the tail, so each survivor moves at most once. @p relocatedFn(entity, newRow) runs for every moved row.
+        template<typename RelocatedFn>
+        void RemoveRows(std::span<const NGIN::UIntSize> rows, RelocatedFn&& relocatedFn)
+        {
+            if (!rows.empty() && rows.back() >= m_count)
+            {
+                throw std::out_of_range("Row index out of range.");
             }
 
-            if (m_entities.Size() > 0)
+            for (const auto row : rows)
             {
-                m_entities.PopBack();
+                DestroyRow(row);
             }
-            --m_count;
-            return result;
+
+            // Holes are taken from the front of the list, survivors from the back of the chunk; removed rows at the
+            // back are simply cut off.
+            NGIN::UIntSize front = 0;
+            NGIN::UIntSize back  = rows.size();
+            NGIN::UIntSize last  = m_count;
+            for (; front < back; ++front)
+            {
+                while (back > front && rows[back - 1] == last - 1)
+                {
+                    --back;
+                    --last;
+                }
+                if (front == back)
+                {
+                    break;
+                }
+                --last;
+                MoveRow(last, rows[front]);
+                relocatedFn(m_entities[rows[front]], rows[front]);
+            }
+            m_count = last;
         }
 
         void Reset() noexcept
@@ -289,19 +431,77 @@ namespace NGIN::ECS
             {
                 DestroyRow(row);
             }
-            m_entities.Clear();
             m_count = 0;
+            for (NGIN::UIntSize columnIndex = 0; columnIndex < m_columns.Size(); ++columnIndex)
+            {
+                m_columns[columnIndex].MaxAddedTick   = 0;
+                m_columns[columnIndex].MaxChangedTick = 0;
+            }
         }
 
     private:
+        /// @brief Raises a chunk tick summary to at least @p tick. Parallel iteration may mark different rows of one
+        /// chunk from several threads, so this is an atomic max; relaxed ordering is enough since the summary is only
+        /// read after the parallel loop has joined.
+        static void RaiseMaxTick(NGIN::UInt64& summary, NGIN::UInt64 tick) noexcept
+        {
+            std::atomic_ref<NGIN::UInt64> current {summary};
+            auto                          observed = current.load(std::memory_order_relaxed);
+            while (observed < tick && !current.compare_exchange_weak(observed, tick, std::memory_order_relaxed))
+            {
+            }
+        }
+
         struct Column
         {
             ComponentInfo  Info {};
             void*          Data {nullptr};
             NGIN::UInt64*  AddedTicks {nullptr};
             NGIN::UInt64*  ChangedTicks {nullptr};
+            NGIN::UInt64   MaxAddedTick {0};
+            NGIN::UInt64   MaxChangedTick {0};
         };
 
+        [[nodiscard]] static constexpr NGIN::UIntSize AlignUp(NGIN::UIntSize value, NGIN::UIntSize alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /// @brief Walks the block layout: the entity array first, then per column its data, added and changed ticks.
+        /// Every array starts on a cache line (or the component's own alignment if stricter). The visitor receives
+        /// kInvalidIndex as the column index for the entity array, as the data offset for empty columns, and as the
+        /// tick offsets for columns that opted out of change tracking.
+        template<typename Visitor>
+        static NGIN::UIntSize WalkLayout(const NGIN::Containers::Vector<ComponentInfo>& components,
+                                         NGIN::UIntSize capacity,
+                                         Visitor&& visit) noexcept
+        {
+            NGIN::UIntSize offset = 0;
+            visit(kInvalidIndex, offset, kInvalidIndex, kInvalidIndex);
+            offset += sizeof(EntityId) * capacity;
+
+            for (NGIN::UIntSize columnIndex = 0; columnIndex < components.Size(); ++columnIndex)
+            {
+                const auto& info       = components[columnIndex];
+                auto        dataOffset = kInvalidIndex;
+                if (!info.IsEmpty)
+                {
+                    dataOffset = AlignUp(offset, (std::max)(info.Align, kChunkAlignment));
+                    offset     = dataOffset + info.Size * capacity;
+                }
+                if (!info.TrackChanges)
+                {
+                    visit(columnIndex, dataOffset, kInvalidIndex, kInvalidIndex);
+                    continue;
+                }
+                const auto addedOffset   = AlignUp(offset, kChunkAlignment);
+                const auto changedOffset = AlignUp(addedOffset + sizeof(NGIN::UInt64) * capacity, kChunkAlignment);
+                offset                   = changedOffset + sizeof(NGIN::UInt64) * capacity;
+                visit(columnIndex, dataOffset, addedOffset, changedOffset);
+            }
+            return AlignUp(offset, kChunkAlignment);
+        }
+
         void DestroyElement(NGIN::UIntSize columnIndex, NGIN::UIntSize row) noexcept
         {
             auto& column = m_columns[columnIndex];
@@ -312,6 +512,22 @@ namespace NGIN::ECS
             column.Info.Destroy(ComponentPtr(columnIndex, row));
         }
 
+        /// @brief Relocates every column, the ticks and the entity of @p sourceRow into the vacated @p destinationRow.
+        void MoveRow(NGIN::UIntSize sourceRow, NGIN::UIntSize destinationRow)
+        {
+            for (NGIN::UIntSize columnIndex = 0; columnIndex < m_columns.Size(); ++columnIndex)
+            {
+                MoveElement(columnIndex, sourceRow, destinationRow);
+                auto& column = m_columns[columnIndex];
+                if (column.AddedTicks)
+                {
+                    column.AddedTicks[destinationRow]   = column.AddedTicks[sourceRow];
+                    column.ChangedTicks[destinationRow] = column.ChangedTicks[sourceRow];
+                }
+            }
+            m_entities[destinationRow] = m_entities[sourceRow];
+        }
+
         void MoveElement(NGIN::UIntSize columnIndex, NGIN::UIntSize sourceRow, NGIN::UIntSize destinationRow)
         {
             auto& column = m_columns[columnIndex];
@@ -347,8 +563,11 @@ namespace NGIN::ECS
 
     private:
         NGIN::Memory::SystemAllocator          m_allocator {};
+        ChunkPool*                             m_pool {nullptr};
+        std::byte*                             m_block {nullptr};
+        NGIN::UIntSize                         m_blockBytes {0};
         NGIN::Containers::Vector<Column>       m_columns;
-        NGIN::Containers::Vector<EntityId>     m_entities;
+        EntityId*                              m_entities {nullptr};
         NGIN::UIntSize                         m_count {0};
         NGIN::UIntSize                         m_capacity {0};
     };
@@ -356,9 +575,14 @@ namespace NGIN::ECS
     class Archetype
     {
     public:
-        explicit Archetype(ArchetypeSignature signature, NGIN::Containers::Vector<ComponentInfo> components)
-            : m_signature(std::move(signature)), m_components(std::move(components))
+        explicit Archetype(ArchetypeSignature signature,
+                           NGIN::Containers::Vector<ComponentInfo> components,
+                           NGIN::UIntSize chunkBytes = kDefaultChunkBytes,
+                           ChunkPool* chunkPool = nullptr)
+            : m_signature(std::move(signature)), m_components(std::move(components)), m_chunkPool(chunkPool)
         {
+            BuildColumnLookup();
+            SetChunkBytes(chunkBytes);
         }
 
         Archetype(const Archetype&)            = delete;
@@ -367,9 +591,24 @@ namespace NGIN::ECS
         Archetype& operator=(Archetype&&)      = delete;
 
         [[nodiscard]] const ArchetypeSignature& Signature() const noexcept { return m_signature; }
+        /// @brief Component-index bitset of this archetype's signature, used for query matching.
+        [[nodiscard]] const ComponentMask& Mask() const noexcept { return m_mask; }
         [[nodiscard]] NGIN::UIntSize ComponentCount() const noexcept { return m_components.Size(); }
         [[nodiscard]] const ComponentInfo& ComponentAt(NGIN::UIntSize index) const noexcept { return m_components[index]; }
         [[nodiscard]] NGIN::UIntSize ChunkCount() const noexcept { return m_chunks.Size(); }
+        [[nodiscard]] NGIN::UIntSize ChunkBytes() const noexcept { return m_chunkBytes; }
+        [[nodiscard]] NGIN::UIntSize ChunkCapacity() const noexcept { return m_chunkCapacity; }
+
+        /// @brief Sets the byte budget for chunks allocated from now on; existing chunks keep their layout.
+        void SetChunkBytes(NGIN::UIntSize chunkBytes)
+        {
+            if (chunkBytes == 0)
+            {
+                throw std::invalid_argument("Chunk byte budget must be non-zero.");
+            }
+            m_chunkBytes    = chunkBytes;
+            m_chunkCapacity = ComputeCapacityForChunkBytes(chunkBytes);
+        }
 
         [[nodiscard]] Chunk* GetChunk(NGIN::UIntSize index) const noexcept
         {
@@ -381,6 +620,39 @@ namespace NGIN::ECS
             return FindColumnIndex(typeId) != kInvalidIndex;
         }
 
+        template<typename T>
+        [[nodiscard]] bool Has() const
+        {
+            return FindColumn(GetComponentIndex<T>()) != kInvalidIndex;
+        }
+
+        /// @brief Constant-time column lookup by dense component index; kInvalidIndex when absent.
+        [[nodiscard]] NGIN::UIntSize FindColumn(ComponentIndex componentIndex) const noexcept
+        {
+            if (m_columnLookupDense)
+            {
+                const auto slot = static_cast<NGIN::UIntSize>(componentIndex - m_columnLookupBase);
+                if (componentIndex < m_columnLookupBase || slot >= m_columnLookup.Size())
+                {
+                    return kInvalidIndex;
+                }
+                const auto column = m_columnLookup[slot];
+                return column == kInvalidComponentIndex ? kInvalidIndex : column;
+            }
+            return FindColumnSparse(componentIndex);
+        }
+
+        /// @brief Throwing variant of FindColumn().
+        [[nodiscard]] NGIN::UIntSize RequireColumn(ComponentIndex componentIndex) const
+        {
+            const auto index = FindColumn(componentIndex);
+            if (index == kInvalidIndex)
+            {
+                throw std::out_of_range("Component is not present in archetype.");
+            }
+            return index;
+        }
+
         [[nodiscard]] NGIN::UIntSize FindColumnIndex(TypeId typeId) const noexcept
         {
             for (NGIN::UIntSize index = 0; index < m_components.Size(); ++index)
@@ -403,22 +675,51 @@ namespace NGIN::ECS
             return index;
         }
 
+        /// @brief Destination archetype reached by adding @p typeId, or kInvalidIndex if not cached yet.
+        [[nodiscard]] NGIN::UIntSize FindAddEdge(TypeId typeId) const noexcept
+        {
+            const auto* destination = m_addEdges.GetPtr(typeId);
+            return destination ? *destination : kInvalidIndex;
+        }
+
+        /// @brief Destination archetype reached by removing @p typeId, or kInvalidIndex if not cached yet.
+        [[nodiscard]] NGIN::UIntSize FindRemoveEdge(TypeId typeId) const noexcept
+        {
+            const auto* destination = m_removeEdges.GetPtr(typeId);
+            return destination ? *destination : kInvalidIndex;
+        }
+
+        void SetAddEdge(TypeId typeId, NGIN::UIntSize archetypeIndex)
+        {
+            m_addEdges.Insert(typeId, archetypeIndex);
+        }
+
+        void SetRemoveEdge(TypeId typeId, NGIN::UIntSize archetypeIndex)
+        {
+            m_removeEdges.Insert(typeId, archetypeIndex);
+        }
+
         [[nodiscard]] NGIN::UIntSize ComputeCapacityForChunkBytes(NGIN::UIntSize chunkBytes) const noexcept
         {
             NGIN::UIntSize rowBytes = sizeof(EntityId);
             for (NGIN::UIntSize index = 0; index < m_components.Size(); ++index)
             {
-                rowBytes += (2 * sizeof(NGIN::UInt64));
+                if (m_components[index].TrackChanges)
+                {
+                    rowBytes += (2 * sizeof(NGIN::UInt64));
+                }
                 if (!m_components[index].IsEmpty)
                 {
                     rowBytes += m_components[index].Size;
                 }
             }
-            if (rowBytes == 0)
+
+            // Start from the padding-free estimate, then give back rows until the aligned layout fits.
+            auto capacity = chunkBytes / rowBytes;
+            while (capacity > 1 && Chunk::ComputeBlockBytes(m_components, capacity) > chunkBytes)
             {
-                return 1;
+                --capacity;
             }
-            const auto capacity = chunkBytes / rowBytes;
             return capacity == 0 ? 1 : capacity;
         }
 
@@ -444,6 +745,94 @@ namespace NGIN::ECS
             return ArchetypeRowAddress {chunkIndex, row};
         }
 
+        /// @brief Grows the chunk list's capacity for the chunks @p rowCount more rows need, so a bulk insert never
+        /// reallocates it mid-run. Chunk blocks themselves are still acquired from the pool as each chunk is opened.
+        void ReserveChunkSlots(NGIN::UIntSize rowCount)
+        {
+            NGIN::UIntSize room = 0;
+            if (m_chunks.Size() > 0)
+            {
+                const auto* last = m_chunks[m_chunks.Size() - 1].Get();
+                room             = last->Capacity() - last->Count();
+            }
+            if (rowCount <= room)
+            {
+                return;
+            }
+            const auto newChunks = (rowCount - room + m_chunkCapacity - 1) / m_chunkCapacity;
+            m_chunks.Reserve(m_chunks.Size() + newChunks);
+        }
+
+        /// @brief Appends @p rowCount rows, filling one chunk at a time.
+        ///
+        /// @p entityFn(item) names the entity of each new row and @p initializer(chunk, chunkIndex, row, column, info,
+        /// item) constructs its columns, as in EmplaceRow(). @p placedFn(item, address) runs once a row is complete.
+        /// If a column throws, that row is rolled back and rows placed before it stay.
+        template<typename EntityFn, typename Initializer, typename PlacedFn>
+        void EmplaceRows(NGIN::UIntSize rowCount, EntityFn&& entityFn, Initializer&& initializer, PlacedFn&& placedFn)
+        {
+            ReserveChunkSlots(rowCount);
+            NGIN::UIntSize item = 0;
+            while (item < rowCount)
+            {
+                auto [chunkIndex, chunk] = EnsureChunkWithRoom();
+                const auto segmentEnd    = item + (std::min)(chunk->Capacity() - chunk->Count(), rowCount - item);
+                for (; item < segmentEnd; ++item)
+                {
+                    const auto row = chunk->BeginRow(entityFn(item));
+
+                    NGIN::UIntSize completedColumns = 0;
+                    try
+                    {
+                        for (; completedColumns < m_components.Size(); ++completedColumns)
+                        {
+                            initializer(*chunk, chunkIndex, row, completedColumns, m_components[completedColumns], item);
+                        }
+                    } catch (...)
+                    {
+                        chunk->RollbackNewRow(row, completedColumns);
+                        throw;
+                    }
+                    placedFn(item, ArchetypeRowAddress {chunkIndex, row});
+                }
+            }
+        }
+
+        /// @brief Appends one row per element of @p entities, filling one chunk at a time and each column of that chunk
+        /// as a single run.
+        ///
+        /// @p columnFn(chunk, column, info, firstRow, rowCount, firstItem) constructs rows [firstRow, firstRow +
+        /// rowCount) of a column from items starting at @p firstItem, destroying what it built if it throws.
+        /// @p placedFn(firstItem, chunkIndex, firstRow, rowCount) runs once every column of a run is complete. If a
+        /// column throws, that run is rolled back and runs placed before it stay.
+        template<typename ColumnFn, typename PlacedFn>
+        void AppendRows(std::span<const EntityId> entities, ColumnFn&& columnFn, PlacedFn&& placedFn)
+        {
+            ReserveChunkSlots(entities.size());
+            NGIN::UIntSize item = 0;
+            while (item < entities.size())
+            {
+                auto [chunkIndex, chunk] = EnsureChunkWithRoom();
+                const auto rowCount      = (std::min)(chunk->Capacity() - chunk->Count(), entities.size() - item);
+                const auto firstRow      = chunk->BeginRows(entities.data() + item, rowCount);
+
+                NGIN::UIntSize completedColumns = 0;
+                try
+                {
+                    for (; completedColumns < m_components.Size(); ++completedColumns)
+                    {
+                        columnFn(*chunk, completedColumns, m_components[completedColumns], firstRow, rowCount, item);
+                    }
+                } catch (...)
+                {
+                    chunk->RollbackNewRows(firstRow, rowCount, completedColumns);
+                    throw;
+                }
+                placedFn(item, chunkIndex, firstRow, rowCount);
+                item += rowCount;
+            }
+        }
+
         template<typename RelocatedEntityFn>
         void RemoveRow(NGIN::UIntSize chunkIndex, NGIN::UIntSize rowIndex, RelocatedEntityFn&& relocatedEntityFn)
         {
@@ -475,15 +864,115 @@ namespace NGIN::ECS
             }
         }
 
+        /// @brief Removes @p rows (ascending, no duplicates) of chunk @p chunkIndex in one compaction pass, reporting
+        /// moved rows as RemoveRow() does. A chunk left empty stays in the list until ReleaseEmptyChunks(), so chunk
+        /// indices are stable across several calls.
+        template<typename RelocatedEntityFn>
+        void RemoveRows(NGIN::UIntSize chunkIndex, std::span<const NGIN::UIntSize> rows, RelocatedEntityFn&& relocatedEntityFn)
+        {
+            auto* chunk = GetChunk(chunkIndex);
+            if (!chunk)
+            {
+                throw std::out_of_range("Chunk index out of range.");
+            }
+            chunk->RemoveRows(rows, [&](EntityId movedEntity, NGIN::UIntSize rowIndex) {
+                relocatedEntityFn(movedEntity, chunkIndex, rowIndex);
+            });
+        }
+
+        /// @brief Frees every empty chunk, moving chunks from the end of the list into the gaps and reporting the rows
+        /// of each moved chunk under its new index.
+        template<typename RelocatedEntityFn>
+        void ReleaseEmptyChunks(RelocatedEntityFn&& relocatedEntityFn)
+        {
+            NGIN::UIntSize chunkIndex = 0;
+            while (chunkIndex < m_chunks.Size())
+            {
+                if (m_chunks[chunkIndex]->Count() != 0)
+                {
+                    ++chunkIndex;
+                    continue;
+                }
+
+                const auto lastChunkIndex = m_chunks.Size() - 1;
+                if (chunkIndex != lastChunkIndex)
+                {
+                    m_chunks[chunkIndex] = std::move(m_chunks[lastChunkIndex]);
+                    const auto* movedChunk = m_chunks[chunkIndex].Get();
+                    for (NGIN::UIntSize row = 0; row < movedChunk->Count(); ++row)
+                    {
+                        relocatedEntityFn(movedChunk->EntityAt(row), chunkIndex, row);
+                    }
+                }
+                m_chunks.PopBack();
+            }
+        }
+
     private:
+        /// @brief Index windows wider than this fall back to a sorted (index, column) list searched by bisection.
+        static constexpr NGIN::UIntSize kDenseColumnLookupLimit = 1024;
+
+        /// @brief Builds the component mask and the component-index -> column table over [min index, max index].
+        void BuildColumnLookup()
+        {
+            for (NGIN::UIntSize column = 0; column < m_components.Size(); ++column)
+            {
+                m_mask.Set(m_components[column].Index);
+            }
+            if (m_components.Size() == 0)
+            {
+                return;
+            }
+
+            auto minIndex = m_components[0].Index;
+            auto maxIndex = m_components[0].Index;
+            for (NGIN::UIntSize column = 1; column < m_components.Size(); ++column)
+            {
+                minIndex = (std::min)(minIndex, m_components[column].Index);
+                maxIndex = (std::max)(maxIndex, m_components[column].Index);
+            }
+
+            const auto window = static_cast<NGIN::UIntSize>(maxIndex - minIndex) + 1;
+            m_columnLookupBase  = minIndex;
+            m_columnLookupDense = window <= kDenseColumnLookupLimit;
+            if (m_columnLookupDense)
+            {
+                m_columnLookup.Reserve(window);
+                for (NGIN::UIntSize slot = 0; slot < window; ++slot)
+                {
+                    m_columnLookup.EmplaceBack(kInvalidComponentIndex);
+                }
+                for (NGIN::UIntSize column = 0; column < m_components.Size(); ++column)
+                {
+                    m_columnLookup[m_components[column].Index - minIndex] = static_cast<ComponentIndex>(column);
+                }
+                return;
+            }
+
+            m_columnLookupSparse.Reserve(m_components.Size());
+            for (NGIN::UIntSize column = 0; column < m_components.Size(); ++column)
+            {
+                m_columnLookupSparse.EmplaceBack(m_components[column].Index, static_cast<ComponentIndex>(column));
+            }
+            std::sort(m_columnLookupSparse.begin(), m_columnLookupSparse.end());
+        }
+
+        [[nodiscard]] NGIN::UIntSize FindColumnSparse(ComponentIndex componentIndex) const noexcept
+        {
+            const auto it = std::lower_bound(m_columnLookupSparse.begin(), m_columnLookupSparse.end(), componentIndex,
+                                             [](const auto& entry, ComponentIndex key) { return entry.first < key; });
+            if (it == m_columnLookupSparse.end() || it->first != componentIndex)
+            {
+                return kInvalidIndex;
+            }
+            return it->second;
+        }
+
         [[nodiscard]] std::pair<NGIN::UIntSize, Chunk*> EnsureChunkWithRoom()
         {
             if (m_chunks.Size() == 0 || !m_chunks[m_chunks.Size() - 1]->HasRoom())
             {
-                auto chunk = NGIN::Memory::MakeScoped<Chunk>(
-                    m_components,
-                    ComputeCapacityForChunkBytes(kDefaultChunkBytes)
-                );
+                auto chunk = NGIN::Memory::MakeScoped<Chunk>(m_components, m_chunkCapacity, m_chunkPool);
                 m_chunks.EmplaceBack(std::move(chunk));
             }
             return {m_chunks.Size() - 1, m_chunks[m_chunks.Size() - 1].Get()};
@@ -492,7 +981,17 @@ namespace NGIN::ECS
     private:
         ArchetypeSignature                                      m_signature;
         NGIN::Containers::Vector<ComponentInfo>                 m_components;
+        ComponentMask                                           m_mask;
+        NGIN::Containers::Vector<ComponentIndex>                m_columnLookup;
+        ComponentIndex                                          m_columnLookupBase {0};
+        NGIN::Containers::Vector<std::pair<ComponentIndex, ComponentIndex>> m_columnLookupSparse;
+        bool                                                    m_columnLookupDense {true};
         NGIN::Containers::Vector<NGIN::Memory::Scoped<Chunk>>   m_chunks;
+        ChunkPool*                                              m_chunkPool {nullptr};
+        NGIN::UIntSize                                          m_chunkBytes {kDefaultChunkBytes};
+        NGIN::UIntSize                                          m_chunkCapacity {1};
+        NGIN::Containers::FlatHashMap<TypeId, NGIN::UIntSize>   m_addEdges;
+        NGIN::Containers::FlatHashMap<TypeId, NGIN::UIntSize>   m_removeEdges;
     };
 }
 
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <NGIN/ECS/Export.hpp>
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Containers/Vector.hpp>
+#include <NGIN/Memory/SystemAllocator.hpp>
+
+#include <cstddef>
+
+namespace NGIN::ECS
+{
+    /// @brief Alignment of every chunk block (one cache line).
+    inline constexpr NGIN::UIntSize kChunkAlignment = 64;
+
+    /// @brief Size-class step for blocks larger than one step; smaller blocks only round up to kChunkAlignment.
+    inline constexpr NGIN::UIntSize kChunkBlockGranularity = 4 * 1024;
+
+    struct ChunkPoolOptions
+    {
+        /// @brief Most free blocks kept per size class; blocks released beyond it go back to the system.
+        NGIN::UIntSize MaxBlocksPerClass {64};
+        /// @brief Most free bytes kept across all size classes.
+        NGIN::UIntSize MaxPooledBytes {16 * 1024 * 1024};
+    };
+
+    struct ChunkPoolStats
+    {
+        NGIN::UInt64   Acquired {0};  ///< Blocks handed out in total.
+        NGIN::UInt64   Reused {0};    ///< Acquisitions served from a free list.
+        NGIN::UInt64   Released {0};  ///< Blocks given back by chunks.
+        NGIN::UInt64   Freed {0};     ///< Blocks returned to the system allocator.
+        NGIN::UIntSize PooledBlocks {0};
+        NGIN::UIntSize PooledBytes {0};
+    };
+
+    /// @brief World-owned recycler for chunk blocks, bucketed by size class.
+    ///
+    /// A class is the request rounded up to kChunkAlignment, or to kChunkBlockGranularity once it exceeds one step, so
+    /// a block is never more than 4 KiB larger than asked for while near-identical budgets still share free lists.
+    ///
+    /// Not thread-safe; chunks are only created and destroyed during structural changes on the owning world.
+    class NGIN_ECS_API ChunkPool
+    {
+    public:
+        ChunkPool() = default;
+        explicit ChunkPool(const ChunkPoolOptions& options) noexcept
+            : m_options(options)
+        {
+        }
+
+        ChunkPool(const ChunkPool&)            = delete;
+        ChunkPool& operator=(const ChunkPool&) = delete;
+        ChunkPool(ChunkPool&&)                 = delete;
+        ChunkPool& operator=(ChunkPool&&)      = delete;
+
+        ~ChunkPool();
+
+        /// @brief Size class (and therefore real block size) that serves a request of @p bytes.
+        [[nodiscard]] static NGIN::UIntSize SizeClassBytes(NGIN::UIntSize bytes) noexcept;
+
+        /// @brief Returns a block of SizeClassBytes(bytes) bytes aligned to kChunkAlignment.
+        [[nodiscard]] std::byte* Acquire(NGIN::UIntSize bytes);
+
+        /// @brief Takes back a block obtained from Acquire(@p bytes).
+        void Release(std::byte* block, NGIN::UIntSize bytes) noexcept;
+
+        /// @brief Frees every pooled block.
+        void Trim() noexcept;
+
+        [[nodiscard]] const ChunkPoolOptions& Options() const noexcept { return m_options; }
+
+        /// @brief Replaces the high-water marks and trims any excess right away.
+        void SetOptions(const ChunkPoolOptions& options) noexcept;
+
+        [[nodiscard]] const ChunkPoolStats& Stats() const noexcept { return m_stats; }
+
+    private:
+        struct SizeClass
+        {
+            NGIN::UIntSize                       Bytes {0};
+            NGIN::Containers::Vector<std::byte*> Blocks;
+        };
+
+        /// @brief Free list for @p classBytes, created on first use.
+        [[nodiscard]] NGIN::Containers::Vector<std::byte*>& FreeListFor(NGIN::UIntSize classBytes);
+        [[nodiscard]] NGIN::Containers::Vector<std::byte*>* FindFreeList(NGIN::UIntSize classBytes) noexcept;
+
+        void FreeBlock(std::byte* block, NGIN::UIntSize classBytes) noexcept;
+        void EnforceHighWaterMarks() noexcept;
+
+    private:
+        NGIN::Memory::SystemAllocator       m_allocator {};
+        ChunkPoolOptions                    m_options {};
+        ChunkPoolStats                      m_stats {};
+        NGIN::Containers::Vector<SizeClass> m_classes; ///< Few entries per world: one per distinct block size.
+    };
+}// namespace NGIN::ECS
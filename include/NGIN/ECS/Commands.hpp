@@ -3,34 +3,105 @@
 #include <NGIN/ECS/Export.hpp>
 #include <NGIN/ECS/World.hpp>
 #include <NGIN/Containers/Vector.hpp>
+#include <NGIN/Memory/SystemAllocator.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <new>
+#include <span>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
 namespace NGIN::ECS
 {
+    struct CommandFlushOptions
+    {
+        /// @brief Apply runs of consecutive operations of the same type as one group where the operation supports
+        /// it: a run of spawns with identical component types resolves its archetype once and fills rows in bulk.
+        bool BatchConsecutive {true};
+        /// @brief Merge operations per entity before applying them: edits on an entity that is despawned later in the
+        /// buffer are dropped, repeated Set<T> calls keep only the last value, and an entity's Add/Remove calls move
+        /// it to its final archetype in one migration. Everything recorded before the last ClearWorld() is dropped.
+        /// Assumes the recorded sequence is valid; edits that would have thrown may be dropped instead.
+        bool Coalesce {false};
+    };
+
+    /// @brief Deferred structural changes, applied to a world in recording order by Flush().
+    ///
+    /// A buffer bound to a world (see Bind()) reserves the id of every entity it spawns right away, so the returned
+    /// id can be used by later commands in the same buffer; the entity becomes alive when the buffer is flushed.
+    ///
+    /// Payloads live in a paged bump arena: a record is placement-new plus a pointer bump, existing records never
+    /// move, and pages are kept across Flush()/Clear() so a buffer reused every frame stops allocating once warm.
     class NGIN_ECS_API Commands
     {
     public:
+        /// @brief Size of a regular arena page; larger payloads get a dedicated page of their own size.
+        static constexpr NGIN::UIntSize kPageBytes = 64 * 1024;
+
         Commands() = default;
+        explicit Commands(World& world)
+            : m_world(&world)
+        {
+        }
+
         Commands(const Commands&)            = delete;
         Commands& operator=(const Commands&) = delete;
         Commands(Commands&&)                 = delete;
         Commands& operator=(Commands&&)      = delete;
 
+        /// @brief Drops pending operations like Clear(). The bound world must outlive a buffer that still holds
+        /// operations, since their reservations are given back to it.
         ~Commands()
         {
-            Clear();
+            try
+            {
+                Clear();
+            } catch (...)
+            {
+                // Out of memory while giving reservations back; those ids just stay reserved.
+            }
+            for (NGIN::UIntSize index = 0; index < m_pages.Size(); ++index)
+            {
+                m_allocator.Deallocate(m_pages[index].Data, m_pages[index].Bytes, kPageAlignment);
+            }
+        }
+
+        /// @brief Binds the buffer to @p world (or unbinds it with nullptr). Throws std::logic_error when operations
+        /// for another world are still pending.
+        void Bind(World* world)
+        {
+            if (world != m_world && m_records.Size() > 0)
+            {
+                throw std::logic_error("Cannot rebind a command buffer with pending operations.");
+            }
+            m_world = world;
         }
 
+        [[nodiscard]] World* BoundWorld() const noexcept { return m_world; }
+
+        /// @brief Queues a spawn. When bound, returns the entity's reserved id; otherwise returns NullEntityId.
         template<typename... Cs>
-        void Spawn(Cs&&... components)
+        EntityId Spawn(Cs&&... components)
         {
             using Operation = SpawnOperation<std::decay_t<Cs>...>;
-            StoreOperation<Operation>(std::forward<Cs>(components)...);
+            const auto entityId = m_world ? m_world->ReserveEntity() : NullEntityId;
+            try
+            {
+                StoreOperation<Operation>(entityId, std::forward<Cs>(components)...);
+            } catch (...)
+            {
+                if (m_world)
+                {
+                    m_world->ReleaseReservedEntity(entityId);
+                }
+                throw;
+            }
+            return entityId;
         }
 
         void Despawn(EntityId entityId)
@@ -64,50 +135,182 @@ namespace NGIN::ECS
             StoreOperation<ClearWorldOperation>();
         }
 
-        void Clear() noexcept
+        /// @brief Drops every pending operation; ids reserved by spawns that were not flushed are given back.
+        ///
+        /// Giving an id back may allocate in the world's entity table. If that throws, the remaining reservations are
+        /// kept but every operation is still dropped before the exception propagates.
+        void Clear()
         {
+            std::exception_ptr releaseError;
             for (NGIN::UIntSize index = 0; index < m_records.Size(); ++index)
             {
-                m_records[index].Destroy(m_storage.data() + m_records[index].Offset);
+                const auto& record = m_records[index];
+                if (m_world && record.Table->Reserved && !releaseError)
+                {
+                    try
+                    {
+                        m_world->ReleaseReservedEntity(record.Table->Reserved(record.Payload));
+                    } catch (...)
+                    {
+                        releaseError = std::current_exception();
+                    }
+                }
+                record.Table->Destroy(record.Payload);
+            }
+            ResetArena();
+            if (releaseError)
+            {
+                std::rethrow_exception(releaseError);
             }
-            m_records.Clear();
-            m_storage.Clear();
         }
 
-        void Flush(World& world)
+        void Flush(World& world, const CommandFlushOptions& options = {})
         {
-            for (NGIN::UIntSize index = 0; index < m_records.Size(); ++index)
+            if (m_world && m_world != &world)
             {
-                auto& record = m_records[index];
-                void* payload = m_storage.data() + record.Offset;
-                record.Apply(payload, world);
-                record.Destroy(payload);
+                throw std::logic_error("Command buffer is bound to a different world.");
             }
-            m_records.Clear();
-            m_storage.Clear();
+
+            try
+            {
+                const bool planned = options.Coalesce;
+                if (planned)
+                {
+                    Coalesce();
+                }
+
+                NGIN::UIntSize index = 0;
+                while (index < m_records.Size())
+                {
+                    if (planned && m_plan[index].Skip)
+                    {
+                        ++index;
+                        continue;
+                    }
+                    if (planned && m_plan[index].MigrationCount > 0)
+                    {
+                        ApplyMigration(index, world);
+                        ++index;
+                        continue;
+                    }
+
+                    auto&          record = m_records[index];
+                    NGIN::UIntSize runEnd = index + 1;
+                    if (options.BatchConsecutive && record.Table->ApplyBatch)
+                    {
+                        while (runEnd < m_records.Size() && m_records[runEnd].Table->Type == record.Table->Type
+                               && (!planned || (!m_plan[runEnd].Skip && m_plan[runEnd].MigrationCount == 0)))
+                        {
+                            ++runEnd;
+                        }
+                    }
+
+                    if (runEnd - index > 1)
+                    {
+                        record.Table->ApplyBatch(&record, runEnd - index, world);
+                    }
+                    else
+                    {
+                        record.Table->Apply(record.Payload, world);
+                    }
+                    index = runEnd;
+                }
+            } catch (...)
+            {
+                Clear();
+                throw;
+            }
+            Clear();
         }
 
         [[nodiscard]] NGIN::UIntSize Size() const noexcept { return m_records.Size(); }
 
+        /// @brief Bytes of arena pages currently owned (kept across flushes).
+        [[nodiscard]] NGIN::UIntSize ReservedBytes() const noexcept
+        {
+            NGIN::UIntSize bytes = 0;
+            for (NGIN::UIntSize index = 0; index < m_pages.Size(); ++index)
+            {
+                bytes += m_pages[index].Bytes;
+            }
+            return bytes;
+        }
+
     private:
-        using ApplyFn   = void (*)(void* payload, World& world);
-        using DestroyFn = void (*)(void* payload) noexcept;
+        struct Record;
+
+        /// @brief What an operation does to an existing entity, as seen by the coalescing pass.
+        enum class EditKind : NGIN::UInt8
+        {
+            None,
+            ClearWorld,
+            Despawn,
+            Add,
+            Remove,
+            Set,
+        };
+
+        using ApplyFn      = void (*)(void* payload, World& world);
+        using ApplyBatchFn = void (*)(Record* records, NGIN::UIntSize count, World& world);
+        using DestroyFn    = void (*)(void* payload) noexcept;
+        using TargetFn     = EntityId (*)(const void* payload) noexcept;
+        using MigrateFn    = NGIN::UIntSize (*)(void* payload,
+                                                World& world,
+                                                NGIN::UIntSize archetypeIndex,
+                                                NGIN::Containers::Vector<ComponentPayload>& payloads);
+
+        static constexpr NGIN::UIntSize kPageAlignment = alignof(std::max_align_t);
+
+        /// @brief Per-operation-type dispatch table shared by every record of that type.
+        struct OperationTable
+        {
+            TypeId       Type {0};      ///< Operation type; consecutive records of one type can be batched.
+            EditKind     Edit {EditKind::None};
+            TypeId       Component {0}; ///< Component touched by Add/Remove/Set.
+            ApplyFn      Apply {nullptr};
+            ApplyBatchFn ApplyBatch {nullptr};
+            DestroyFn    Destroy {nullptr};
+            TargetFn     Target {nullptr};  ///< Entity edited by Despawn/Add/Remove/Set.
+            TargetFn     Reserved {nullptr}; ///< Spawn: the reserved id it materializes (null when unbound).
+            MigrateFn    Migrate {nullptr}; ///< Add/Remove: folds the edit into a pending migration.
+        };
 
         struct Record
         {
-            NGIN::UIntSize Offset {0};
-            ApplyFn        Apply {nullptr};
-            DestroyFn      Destroy {nullptr};
+            void*                 Payload {nullptr};
+            const OperationTable* Table {nullptr};
+        };
+
+        /// @brief Coalescing verdict for one record.
+        struct PlanEntry
+        {
+            NGIN::UIntSize MigrationFirst {0}; ///< Into m_migrationEdits when this record leads a merged migration.
+            NGIN::UIntSize MigrationCount {0};
+            bool           Skip {false};
+        };
+
+        struct EditKey
+        {
+            EntityId       Entity {NullEntityId};
+            TypeId         Component {0};
+            NGIN::UIntSize Record {0};
+        };
+
+        struct Page
+        {
+            std::byte*     Data {nullptr};
+            NGIN::UIntSize Bytes {0};
         };
 
         template<typename... Cs>
         struct SpawnOperation
         {
-            explicit SpawnOperation(Cs&&... components)
-                : Components(std::forward<Cs>(components)...)
+            explicit SpawnOperation(EntityId entityId, Cs&&... components)
+                : Entity(entityId), Components(std::forward<Cs>(components)...)
             {
             }
 
+            EntityId          Entity {NullEntityId}; ///< Reserved id, or null to create one at flush time.
             std::tuple<Cs...> Components;
         };
 
@@ -169,93 +372,479 @@ namespace NGIN::ECS
             static_cast<Operation*>(payload)->~Operation();
         }
 
+        template<typename Operation>
+        [[nodiscard]] static const OperationTable& TableFor()
+        {
+            using Invoker = OperationInvoker<Operation>;
+            static const OperationTable table = [] {
+                OperationTable result {};
+                result.Type    = GetTypeId<Operation>();
+                result.Edit    = Invoker::kEdit;
+                result.Apply   = &Invoker::Apply;
+                result.Destroy = &DestroyPayload<Operation>;
+                if constexpr (requires { &Invoker::ApplyBatch; })
+                {
+                    result.ApplyBatch = &Invoker::ApplyBatch;
+                }
+                if constexpr (requires { &Invoker::Target; })
+                {
+                    result.Target = &Invoker::Target;
+                }
+                if constexpr (requires { &Invoker::Reserved; })
+                {
+                    result.Reserved = &Invoker::Reserved;
+                }
+                if constexpr (requires { &Invoker::Migrate; })
+                {
+                    result.Migrate = &Invoker::Migrate;
+                }
+                if constexpr (requires { typename Invoker::Component; })
+                {
+                    result.Component = GetTypeId<typename Invoker::Component>();
+                }
+                return result;
+            }();
+            return table;
+        }
+
         template<typename Operation, typename... Args>
         void StoreOperation(Args&&... args)
         {
-            const auto offset = Allocate(sizeof(Operation), alignof(Operation));
-            void* payload = m_storage.data() + offset;
+            const auto& table = TableFor<Operation>();
+            void* payload = Allocate(sizeof(Operation), alignof(Operation));
             ::new (payload) Operation(std::forward<Args>(args)...);
+            m_records.EmplaceBack(Record {payload, &table});
+        }
+
+        [[nodiscard]] EditKind EditAt(NGIN::UIntSize index) const noexcept { return m_records[index].Table->Edit; }
+
+        /// @brief Fills m_plan: which records to skip and which lead a merged per-entity migration.
+        void Coalesce()
+        {
+            const auto count = m_records.Size();
+            m_plan.Clear();
+            m_plan.Reserve(count);
+            for (NGIN::UIntSize index = 0; index < count; ++index)
+            {
+                m_plan.EmplaceBack();
+            }
+            m_migrationEdits.Clear();
+            m_editKeys.Clear();
+
+            // ClearWorld destroys every entity, so nothing recorded before the last one is observable afterwards.
+            NGIN::UIntSize start = 0;
+            for (NGIN::UIntSize index = count; index-- > 0;)
+            {
+                if (EditAt(index) == EditKind::ClearWorld)
+                {
+                    start = index;
+                    break;
+                }
+            }
+            for (NGIN::UIntSize index = 0; index < start; ++index)
+            {
+                m_plan[index].Skip = true;
+            }
+
+            for (NGIN::UIntSize index = start; index < count; ++index)
+            {
+                const auto& record = m_records[index];
+                if (record.Table->Target)
+                {
+                    m_editKeys.EmplaceBack(EditKey {record.Table->Target(record.Payload), record.Table->Component, index});
+                }
+            }
+            std::sort(m_editKeys.begin(), m_editKeys.end(), [](const EditKey& left, const EditKey& right) {
+                return std::tie(left.Entity, left.Component, left.Record) < std::tie(right.Entity, right.Component, right.Record);
+            });
+
+            NGIN::UIntSize first = 0;
+            while (first < m_editKeys.Size())
+            {
+                auto last = first + 1;
+                while (last < m_editKeys.Size() && m_editKeys[last].Entity == m_editKeys[first].Entity)
+                {
+                    ++last;
+                }
+                CoalesceEntity(first, last);
+                first = last;
+            }
+        }
+
+        /// @brief Plans the edits m_editKeys[first, last) of one entity, grouped by component in record order.
+        void CoalesceEntity(NGIN::UIntSize first, NGIN::UIntSize last)
+        {
+            NGIN::UIntSize despawnAt       = kInvalidIndex;
+            NGIN::UIntSize firstStructural = kInvalidIndex;
+            for (NGIN::UIntSize key = first; key < last; ++key)
+            {
+                const auto record = m_editKeys[key].Record;
+                const auto edit   = EditAt(record);
+                if (edit == EditKind::Despawn)
+                {
+                    despawnAt = (std::min)(despawnAt, record);
+                }
+                else if (edit == EditKind::Add || edit == EditKind::Remove)
+                {
+                    firstStructural = (std::min)(firstStructural, record);
+                }
+            }
+
+            if (despawnAt != kInvalidIndex)
+            {
+                for (NGIN::UIntSize key = first; key < last; ++key)
+                {
+                    if (m_editKeys[key].Record < despawnAt)
+                    {
+                        m_plan[m_editKeys[key].Record].Skip = true;
+                    }
+                }
+                return;
+            }
+
+            // A component removed and then added again gets a new value and added tick; that needs both steps, so
+            // such an entity is left exactly as recorded.
+            for (NGIN::UIntSize group = first; group < last; group = ComponentGroupEnd(group, last))
+            {
+                const auto [firstEdit, lastEdit] = StructuralBounds(group, ComponentGroupEnd(group, last));
+                if (firstEdit != kInvalidIndex && EditAt(firstEdit) == EditKind::Remove && EditAt(lastEdit) == EditKind::Add)
+                {
+                    return;
+                }
+            }
 
-            Record record {};
-            record.Offset = offset;
-            record.Apply = &OperationInvoker<Operation>::Apply;
-            record.Destroy = &DestroyPayload<Operation>;
-            m_records.EmplaceBack(record);
+            const auto migrationFirst = m_migrationEdits.Size();
+            for (NGIN::UIntSize group = first; group < last; group = ComponentGroupEnd(group, last))
+            {
+                const auto groupEnd              = ComponentGroupEnd(group, last);
+                const auto [firstEdit, lastEdit] = StructuralBounds(group, groupEnd);
+
+                // Which records of this component survive: the net Add/Remove (if any) and the last Set, unless the
+                // component ends up absent.
+                NGIN::UIntSize keepStructural = kInvalidIndex;
+                bool           keepSets       = true;
+                if (firstEdit != kInvalidIndex)
+                {
+                    const bool endsPresent = EditAt(lastEdit) == EditKind::Add;
+                    const bool wasPresent  = EditAt(firstEdit) == EditKind::Remove;
+                    keepStructural         = endsPresent != wasPresent ? lastEdit : kInvalidIndex;
+                    keepSets               = endsPresent;
+                }
+
+                NGIN::UIntSize lastSet = kInvalidIndex;
+                for (NGIN::UIntSize key = group; key < groupEnd; ++key)
+                {
+                    const auto record = m_editKeys[key].Record;
+                    if (record == keepStructural)
+                    {
+                        continue;
+                    }
+                    m_plan[record].Skip = true;
+                    if (EditAt(record) == EditKind::Set && keepSets && (lastEdit == kInvalidIndex || record > lastEdit))
+                    {
+                        lastSet = record;
+                    }
+                }
+                if (lastSet != kInvalidIndex)
+                {
+                    m_plan[lastSet].Skip = false;
+                }
+                if (keepStructural != kInvalidIndex)
+                {
+                    m_migrationEdits.EmplaceBack(keepStructural);
+                }
+            }
+
+            // A single surviving Add/Remove simply runs where it was recorded.
+            const auto migrationCount = m_migrationEdits.Size() - migrationFirst;
+            if (migrationCount < 2)
+            {
+                while (m_migrationEdits.Size() > migrationFirst)
+                {
+                    m_migrationEdits.PopBack();
+                }
+                return;
+            }
+
+            // Run the merged migration at the entity's first Add/Remove: every surviving Set that needs a component
+            // added here was recorded after that point.
+            std::sort(m_migrationEdits.data() + migrationFirst, m_migrationEdits.data() + m_migrationEdits.Size());
+            for (NGIN::UIntSize edit = migrationFirst; edit < m_migrationEdits.Size(); ++edit)
+            {
+                m_plan[m_migrationEdits[edit]].Skip = true;
+            }
+            auto& leader          = m_plan[firstStructural];
+            leader.Skip           = false;
+            leader.MigrationFirst = migrationFirst;
+            leader.MigrationCount = migrationCount;
+        }
+
+        [[nodiscard]] NGIN::UIntSize ComponentGroupEnd(NGIN::UIntSize group, NGIN::UIntSize last) const noexcept
+        {
+            auto end = group + 1;
+            while (end < last && m_editKeys[end].Component == m_editKeys[group].Component)
+            {
+                ++end;
+            }
+            return end;
         }
 
-        [[nodiscard]] NGIN::UIntSize Allocate(NGIN::UIntSize size, NGIN::UIntSize alignment)
+        /// @brief Records of the first and last Add/Remove in m_editKeys[first, last), or kInvalidIndex for none.
+        [[nodiscard]] std::pair<NGIN::UIntSize, NGIN::UIntSize> StructuralBounds(NGIN::UIntSize first, NGIN::UIntSize last) const noexcept
         {
-            NGIN::UIntSize offset = m_storage.Size();
-            const auto mask = alignment - 1;
-            if (alignment > 1 && (offset & mask) != 0)
+            std::pair<NGIN::UIntSize, NGIN::UIntSize> bounds {kInvalidIndex, kInvalidIndex};
+            for (NGIN::UIntSize key = first; key < last; ++key)
             {
-                offset += alignment - (offset & mask);
+                const auto record = m_editKeys[key].Record;
+                const auto edit   = EditAt(record);
+                if (edit == EditKind::Add || edit == EditKind::Remove)
+                {
+                    if (bounds.first == kInvalidIndex)
+                    {
+                        bounds.first = record;
+                    }
+                    bounds.second = record;
+                }
             }
-            while (m_storage.Size() < offset + size)
+            return bounds;
+        }
+
+        /// @brief Applies the merged Add/Remove edits led by record @p index as one move to the final archetype.
+        void ApplyMigration(NGIN::UIntSize index, World& world)
+        {
+            const auto& leader   = m_records[index];
+            const auto  entityId = leader.Table->Target(leader.Payload);
+            world.ValidateAlive(entityId);
+
+            const auto sourceIndex      = static_cast<NGIN::UIntSize>(world.m_entities.SlotAt(GetEntityIndex(entityId)).ArchetypeIndex);
+            auto       destinationIndex = sourceIndex;
+            m_migrationPayloads.Clear();
+            const auto& plan = m_plan[index];
+            for (NGIN::UIntSize edit = plan.MigrationFirst; edit < plan.MigrationFirst + plan.MigrationCount; ++edit)
             {
-                m_storage.EmplaceBack(std::byte {});
+                const auto& record = m_records[m_migrationEdits[edit]];
+                destinationIndex   = record.Table->Migrate(record.Payload, world, destinationIndex, m_migrationPayloads);
             }
-            return offset;
+            if (destinationIndex != sourceIndex)
+            {
+                world.MoveEntityToArchetype(entityId, destinationIndex, m_migrationPayloads);
+            }
+        }
+
+        [[nodiscard]] void* Allocate(NGIN::UIntSize size, NGIN::UIntSize alignment)
+        {
+            if (m_pageIndex < m_pages.Size())
+            {
+                if (void* payload = BumpCurrentPage(size, alignment))
+                {
+                    return payload;
+                }
+            }
+
+            // Move on to the next kept page that can hold the payload; if none can, append a page sized for it
+            // (oversized payloads get a page of their own).
+            const auto needed = size + (alignment > kPageAlignment ? alignment : 0);
+            for (++m_pageIndex; m_pageIndex < m_pages.Size(); ++m_pageIndex)
+            {
+                m_pageUsed = 0;
+                if (m_pages[m_pageIndex].Bytes >= needed)
+                {
+                    return BumpCurrentPage(size, alignment);
+                }
+            }
+
+            Page page {};
+            page.Bytes = needed > kPageBytes ? needed : kPageBytes;
+            page.Data  = static_cast<std::byte*>(m_allocator.Allocate(page.Bytes, kPageAlignment));
+            if (page.Data == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            m_pages.EmplaceBack(page);
+            m_pageIndex = m_pages.Size() - 1;
+            m_pageUsed  = 0;
+            return BumpCurrentPage(size, alignment);
+        }
+
+        [[nodiscard]] void* BumpCurrentPage(NGIN::UIntSize size, NGIN::UIntSize alignment) noexcept
+        {
+            const auto& page    = m_pages[m_pageIndex];
+            const auto  address = reinterpret_cast<std::uintptr_t>(page.Data) + m_pageUsed;
+            const auto  aligned = (address + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+            const auto  offset  = static_cast<NGIN::UIntSize>(aligned - reinterpret_cast<std::uintptr_t>(page.Data));
+            if (offset + size > page.Bytes)
+            {
+                return nullptr;
+            }
+            m_pageUsed = offset + size;
+            return page.Data + offset;
+        }
+
+        void ResetArena() noexcept
+        {
+            m_records.Clear();
+            m_pageIndex = 0;
+            m_pageUsed  = 0;
         }
 
     private:
-        NGIN::Containers::Vector<Record>      m_records;
-        NGIN::Containers::Vector<std::byte>   m_storage;
+        NGIN::Memory::SystemAllocator    m_allocator {};
+        NGIN::Containers::Vector<Record> m_records;
+        NGIN::Containers::Vector<Page>   m_pages;
+        NGIN::UIntSize                   m_pageIndex {0}; ///< Page currently being bumped.
+        NGIN::UIntSize                   m_pageUsed {0};  ///< Bytes used in that page.
+
+        World*                           m_world {nullptr}; ///< Bound world that reserves spawned ids, if any.
+
+        // Coalescing scratch, kept across flushes.
+        NGIN::Containers::Vector<PlanEntry>        m_plan;
+        NGIN::Containers::Vector<EditKey>          m_editKeys;
+        NGIN::Containers::Vector<NGIN::UIntSize>   m_migrationEdits;
+        NGIN::Containers::Vector<ComponentPayload> m_migrationPayloads;
     };
 
     template<typename... Cs>
     struct Commands::OperationInvoker<Commands::SpawnOperation<Cs...>>
     {
+        static constexpr EditKind kEdit = EditKind::None;
+
         static void Apply(void* payload, World& world)
         {
             auto& operation = *static_cast<Commands::SpawnOperation<Cs...>*>(payload);
             std::apply([&](auto&... components) {
-                (void)world.Spawn(std::move(components)...);
+                (void)world.SpawnReserved(operation.Entity, std::move(components)...);
             }, operation.Components);
         }
+
+        static void ApplyBatch(Commands::Record* records, NGIN::UIntSize count, World& world)
+        {
+            world.template SpawnRows<Cs...>(
+                count,
+                [&](NGIN::UIntSize item) -> std::tuple<Cs...>& {
+                    return static_cast<Commands::SpawnOperation<Cs...>*>(records[item].Payload)->Components;
+                },
+                [&](NGIN::UIntSize item) {
+                    return static_cast<const Commands::SpawnOperation<Cs...>*>(records[item].Payload)->Entity;
+                });
+        }
+
+        static EntityId Reserved(const void* payload) noexcept
+        {
+            return static_cast<const Commands::SpawnOperation<Cs...>*>(payload)->Entity;
+        }
     };
 
     template<>
     struct Commands::OperationInvoker<Commands::DespawnOperation>
     {
+        static constexpr EditKind kEdit = EditKind::Despawn;
+
         static void Apply(void* payload, World& world)
         {
             world.Despawn(static_cast<Commands::DespawnOperation*>(payload)->Entity);
         }
+
+        static void ApplyBatch(Commands::Record* records, NGIN::UIntSize count, World& world)
+        {
+            auto& entities = world.m_batchEntities;
+            entities.Clear();
+            for (NGIN::UIntSize item = 0; item < count; ++item)
+            {
+                entities.EmplaceBack(static_cast<const Commands::DespawnOperation*>(records[item].Payload)->Entity);
+            }
+            world.DespawnBatch(std::span<const EntityId>(entities.data(), entities.Size()));
+        }
+
+        static EntityId Target(const void* payload) noexcept
+        {
+            return static_cast<const Commands::DespawnOperation*>(payload)->Entity;
+        }
     };
 
     template<typename T, typename U>
     struct Commands::OperationInvoker<Commands::AddOperation<T, U>>
     {
+        static constexpr EditKind kEdit = EditKind::Add;
+        using Component                 = T;
+
         static void Apply(void* payload, World& world)
         {
             auto& operation = *static_cast<Commands::AddOperation<T, U>*>(payload);
             world.template Add<T>(operation.Entity, std::move(operation.Value));
         }
+
+        static EntityId Target(const void* payload) noexcept
+        {
+            return static_cast<const Commands::AddOperation<T, U>*>(payload)->Entity;
+        }
+
+        static NGIN::UIntSize Migrate(void* payload,
+                                      World& world,
+                                      NGIN::UIntSize archetypeIndex,
+                                      NGIN::Containers::Vector<ComponentPayload>& payloads)
+        {
+            auto& operation = *static_cast<Commands::AddOperation<T, U>*>(payload);
+            if (world.m_archetypes[archetypeIndex]->template Has<T>())
+            {
+                throw std::invalid_argument("Component already exists on entity.");
+            }
+            payloads.EmplaceBack(world.template CaptureTypedPayload<T>(std::move(operation.Value)));
+            return world.template ResolveAddTransition<T>(archetypeIndex);
+        }
     };
 
     template<typename T>
     struct Commands::OperationInvoker<Commands::RemoveOperation<T>>
     {
+        static constexpr EditKind kEdit = EditKind::Remove;
+        using Component                 = T;
+
         static void Apply(void* payload, World& world)
         {
             (void)world.template Remove<T>(static_cast<Commands::RemoveOperation<T>*>(payload)->Entity);
         }
+
+        static EntityId Target(const void* payload) noexcept
+        {
+            return static_cast<const Commands::RemoveOperation<T>*>(payload)->Entity;
+        }
+
+        static NGIN::UIntSize Migrate(void*,
+                                      World& world,
+                                      NGIN::UIntSize archetypeIndex,
+                                      NGIN::Containers::Vector<ComponentPayload>&)
+        {
+            if (!world.m_archetypes[archetypeIndex]->template Has<T>())
+            {
+                return archetypeIndex;
+            }
+            return world.template ResolveRemoveTransition<T>(archetypeIndex);
+        }
     };
 
     template<typename T, typename U>
     struct Commands::OperationInvoker<Commands::SetOperation<T, U>>
     {
+        static constexpr EditKind kEdit = EditKind::Set;
+        using Component                 = T;
+
         static void Apply(void* payload, World& world)
         {
             auto& operation = *static_cast<Commands::SetOperation<T, U>*>(payload);
             world.template Set<T>(operation.Entity, std::move(operation.Value));
         }
+
+        static EntityId Target(const void* payload) noexcept
+        {
+            return static_cast<const Commands::SetOperation<T, U>*>(payload)->Entity;
+        }
     };
 
     template<>
     struct Commands::OperationInvoker<Commands::ClearWorldOperation>
     {
+        static constexpr EditKind kEdit = EditKind::ClearWorld;
+
         static void Apply(void*, World& world)
         {
             world.Clear();
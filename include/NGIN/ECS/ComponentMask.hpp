@@ -0,0 +1,116 @@
+#pragma once
+
+#include <NGIN/Primitives.hpp>
+#include <NGIN/Containers/Vector.hpp>
+#include <NGIN/ECS/TypeRegistry.hpp>
+
+#include <array>
+
+namespace NGIN::ECS
+{
+    /// @brief Bitset over dense component indices.
+    ///
+    /// The first 256 indices live inline so the common case is a handful of word ANDs with no indirection; higher
+    /// indices spill into a heap-backed tail that only exists on masks that actually use them.
+    class ComponentMask
+    {
+    public:
+        static constexpr NGIN::UIntSize kWordBits    = 64;
+        static constexpr NGIN::UIntSize kInlineWords = 4;
+        static constexpr NGIN::UIntSize kInlineBits  = kInlineWords * kWordBits;
+
+        void Set(ComponentIndex index)
+        {
+            if (index < kInlineBits)
+            {
+                m_inline[index / kWordBits] |= Bit(index);
+                return;
+            }
+            const auto word = static_cast<NGIN::UIntSize>(index - kInlineBits) / kWordBits;
+            while (m_overflow.Size() <= word)
+            {
+                m_overflow.EmplaceBack(NGIN::UInt64 {0});
+            }
+            m_overflow[word] |= Bit(index);
+        }
+
+        [[nodiscard]] bool Test(ComponentIndex index) const noexcept
+        {
+            if (index < kInlineBits)
+            {
+                return (m_inline[index / kWordBits] & Bit(index)) != 0;
+            }
+            const auto word = static_cast<NGIN::UIntSize>(index - kInlineBits) / kWordBits;
+            return word < m_overflow.Size() && (m_overflow[word] & Bit(index)) != 0;
+        }
+
+        /// @brief True when every bit set in @p other is also set here.
+        [[nodiscard]] bool ContainsAll(const ComponentMask& other) const noexcept
+        {
+            NGIN::UInt64 missing = 0;
+            for (NGIN::UIntSize word = 0; word < kInlineWords; ++word)
+            {
+                missing |= other.m_inline[word] & ~m_inline[word];
+            }
+            if (missing != 0)
+            {
+                return false;
+            }
+            for (NGIN::UIntSize word = 0; word < other.m_overflow.Size(); ++word)
+            {
+                const auto mine = word < m_overflow.Size() ? m_overflow[word] : NGIN::UInt64 {0};
+                if ((other.m_overflow[word] & ~mine) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief True when any bit is set in both masks.
+        [[nodiscard]] bool Intersects(const ComponentMask& other) const noexcept
+        {
+            NGIN::UInt64 shared = 0;
+            for (NGIN::UIntSize word = 0; word < kInlineWords; ++word)
+            {
+                shared |= other.m_inline[word] & m_inline[word];
+            }
+            if (shared != 0)
+            {
+                return true;
+            }
+            const auto words = m_overflow.Size() < other.m_overflow.Size() ? m_overflow.Size() : other.m_overflow.Size();
+            for (NGIN::UIntSize word = 0; word < words; ++word)
+            {
+                if ((other.m_overflow[word] & m_overflow[word]) != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            NGIN::UInt64 any = 0;
+            for (NGIN::UIntSize word = 0; word < kInlineWords; ++word)
+            {
+                any |= m_inline[word];
+            }
+            for (NGIN::UIntSize word = 0; word < m_overflow.Size(); ++word)
+            {
+                any |= m_overflow[word];
+            }
+            return any == 0;
+        }
+
+    private:
+        [[nodiscard]] static constexpr NGIN::UInt64 Bit(ComponentIndex index) noexcept
+        {
+            return NGIN::UInt64 {1} << (index % kWordBits);
+        }
+
+        std::array<NGIN::UInt64, kInlineWords> m_inline {};
+        NGIN::Containers::Vector<NGIN::UInt64>  m_overflow;
+    };
+}// namespace NGIN::ECS
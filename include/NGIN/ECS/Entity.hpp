@@ -4,6 +4,9 @@
 #include <NGIN/Primitives.hpp>
 #include <NGIN/Containers/Vector.hpp>
 
+#include <atomic>
+#include <span>
+
 namespace NGIN::ECS
 {
     using EntityId = NGIN::UInt64;
@@ -31,25 +34,113 @@ namespace NGIN::ECS
     }
     [[nodiscard]] inline constexpr bool IsNull(EntityId id) noexcept { return id == NullEntityId; }
 
-    /// @brief Free-list entity allocator with generation counters.
+    /// @brief Marks an EntitySlot location field that does not point anywhere.
+    inline constexpr NGIN::UInt32 kInvalidSlotIndex = 0xFFFFFFFFu;
+
+    enum class EntitySlotState : NGIN::UInt8
+    {
+        Free,
+        Reserved,
+        Alive,
+    };
+
+    /// @brief One entry of the entity table: generation, lifecycle state and storage location in 16 bytes, so a
+    /// liveness check and the location lookup that follows it touch the same cache line.
+    struct EntitySlot
+    {
+        NGIN::UInt32    ArchetypeIndex {kInvalidSlotIndex};
+        NGIN::UInt32    ChunkIndex {kInvalidSlotIndex};
+        NGIN::UInt32    RowIndex {kInvalidSlotIndex};
+        NGIN::UInt16    Generation {1}; // Start at 1 to avoid colliding with NullEntityId (0)
+        EntitySlotState State {EntitySlotState::Reserved};
+
+        [[nodiscard]] bool HasLocation() const noexcept { return ArchetypeIndex != kInvalidSlotIndex; }
+
+        void ClearLocation() noexcept
+        {
+            ArchetypeIndex = kInvalidSlotIndex;
+            ChunkIndex     = kInvalidSlotIndex;
+            RowIndex       = kInvalidSlotIndex;
+        }
+    };
+    static_assert(sizeof(EntitySlot) == 16, "EntitySlot is expected to pack into 16 bytes.");
+
+    /// @brief Free-list entity allocator over a packed slot table.
+    ///
+    /// Each index owns one EntitySlot holding its generation, lifecycle state and the storage location the world
+    /// records for it, so there is a single table to look entities up in.
+    ///
+    /// Besides Create(), ids can be reserved ahead of time (for deferred spawns) with Reserve() and become alive once
+    /// committed. A reserved id is not alive, and is never handed out again until it is committed and destroyed, or
+    /// cancelled. Clear() leaves outstanding reservations intact.
+    ///
+    /// Reserve() is lock-free: it claims free-list entries through an atomic cursor counting down from the top of the
+    /// free list, then fresh indices through an atomic counter. Every other non-const member first reconciles those
+    /// claims into the slot states (see Reconcile()).
     class NGIN_ECS_API EntityAllocator
     {
     public:
         EntityAllocator() = default;
 
         [[nodiscard]] EntityId Create();
+        /// @brief Creates one id per element of @p ids, recycling free indices first and claiming the rest as one
+        /// contiguous range of fresh indices.
+        void                    CreateBatch(std::span<EntityId> ids);
         void                    Destroy(EntityId id);
-        [[nodiscard]] bool      IsAlive(EntityId id) const noexcept;
+        [[nodiscard]] bool      IsAlive(EntityId id) const noexcept { return Find(id) != nullptr; }
         [[nodiscard]] NGIN::UInt64 AliveCount() const noexcept { return m_aliveCount; }
 
+        /// @brief Slot of @p id if it is alive, otherwise nullptr.
+        [[nodiscard]] EntitySlot* Find(EntityId id) noexcept
+        {
+            return const_cast<EntitySlot*>(static_cast<const EntityAllocator*>(this)->Find(id));
+        }
+
+        [[nodiscard]] const EntitySlot* Find(EntityId id) const noexcept
+        {
+            const auto index = GetEntityIndex(id);
+            if (IsNull(id) || index >= m_slots.Size())
+            {
+                return nullptr;
+            }
+            const auto& slot = m_slots[index];
+            return slot.State == EntitySlotState::Alive && slot.Generation == GetEntityGeneration(id) ? &slot : nullptr;
+        }
+
+        /// @brief Slot at @p index, which must be below SlotCount(); used to patch locations of relocated rows.
+        [[nodiscard]] EntitySlot& SlotAt(NGIN::UInt64 index) noexcept { return m_slots[index]; }
+        [[nodiscard]] NGIN::UIntSize SlotCount() const noexcept { return m_slots.Size(); }
+
+        /// @brief Reserves an id without making it alive, preferring recycled indices. Lock-free and safe to call from
+        /// several threads at once, alongside the const members, but not concurrently with other non-const members.
+        [[nodiscard]] EntityId Reserve() noexcept;
+
+        /// @brief Marks the free-list entries claimed by Reserve() as reserved and drops them from the free list.
+        void Reconcile();
+
+        /// @brief Makes a reserved id alive. Throws std::logic_error if @p id is not an outstanding reservation.
+        void Commit(EntityId id);
+
+        /// @brief Gives an uncommitted reservation back; its index is recycled under a new generation.
+        void Cancel(EntityId id);
+
+        [[nodiscard]] bool IsReserved(EntityId id) const noexcept;
+
         void Clear() noexcept;
 
         // Introspection helpers
         [[nodiscard]] NGIN::UInt16 GenerationAtIndex(NGIN::UInt64 index) const noexcept;
 
     private:
-        NGIN::Containers::Vector<NGIN::UInt16> m_generations; // per-index generation
+        /// @brief Extends the slot table to cover @p index; new indices below it were reserved.
+        void GrowTo(NGIN::UInt64 index);
+        void Release(NGIN::UInt64 index);
+
+    private:
+        NGIN::Containers::Vector<EntitySlot>   m_slots;
         NGIN::Containers::Vector<NGIN::UInt64> m_freeList;    // stack of free indices
+        std::atomic<NGIN::Int64>                m_freeCursor {0}; // free-list entries below this are unclaimed
+        std::atomic<NGIN::UInt64>               m_nextIndex {0};  // one past the highest index ever handed out
         NGIN::UInt64                            m_aliveCount {0};
     };
 
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <NGIN/ECS/ComponentMask.hpp>
+#include <NGIN/ECS/ThreadPool.hpp>
 #include <NGIN/ECS/TypeRegistry.hpp>
 #include <NGIN/ECS/World.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -83,6 +89,10 @@ namespace NGIN::ECS
             NGIN::Containers::Vector<TypeId> Writes;
             NGIN::Containers::Vector<TypeId> Changed;
             NGIN::Containers::Vector<TypeId> Added;
+            /// @brief Components an archetype must contain (Required and With terms).
+            ComponentMask                    RequiredMask;
+            /// @brief Components an archetype must not contain.
+            ComponentMask                    WithoutMask;
         };
 
         template<typename Term>
@@ -93,6 +103,7 @@ namespace NGIN::ECS
         {
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.RequiredMask.Set(GetComponentIndex<T>());
                 metadata.Required.EmplaceBack(GetTypeId<T>());
                 metadata.Reads.EmplaceBack(GetTypeId<T>());
             }
@@ -103,6 +114,7 @@ namespace NGIN::ECS
         {
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.RequiredMask.Set(GetComponentIndex<T>());
                 metadata.Required.EmplaceBack(GetTypeId<T>());
                 metadata.Writes.EmplaceBack(GetTypeId<T>());
             }
@@ -123,6 +135,7 @@ namespace NGIN::ECS
         {
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.RequiredMask.Set(GetComponentIndex<T>());
                 metadata.With.EmplaceBack(GetTypeId<T>());
             }
         };
@@ -132,6 +145,7 @@ namespace NGIN::ECS
         {
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.WithoutMask.Set(GetComponentIndex<T>());
                 metadata.Without.EmplaceBack(GetTypeId<T>());
             }
         };
@@ -139,8 +153,12 @@ namespace NGIN::ECS
         template<typename T>
         struct TermMetadataCollector<Changed<T>>
         {
+            static_assert(ComponentTraits<T>::TrackChanges,
+                          "Changed<T> requires T to track changes (ComponentTraits<T>::TrackChanges).");
+
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.RequiredMask.Set(GetComponentIndex<T>());
                 metadata.Required.EmplaceBack(GetTypeId<T>());
                 metadata.Reads.EmplaceBack(GetTypeId<T>());
                 metadata.Changed.EmplaceBack(GetTypeId<T>());
@@ -150,14 +168,33 @@ namespace NGIN::ECS
         template<typename T>
         struct TermMetadataCollector<Added<T>>
         {
+            static_assert(ComponentTraits<T>::TrackChanges,
+                          "Added<T> requires T to track changes (ComponentTraits<T>::TrackChanges).");
+
             static void Collect(QueryTermMetadata& metadata)
             {
+                metadata.RequiredMask.Set(GetComponentIndex<T>());
                 metadata.Required.EmplaceBack(GetTypeId<T>());
                 metadata.Reads.EmplaceBack(GetTypeId<T>());
                 metadata.Added.EmplaceBack(GetTypeId<T>());
             }
         };
 
+        template<typename Term>
+        struct IsRowFilterTerm : std::false_type
+        {
+        };
+
+        template<typename T>
+        struct IsRowFilterTerm<Changed<T>> : std::true_type
+        {
+        };
+
+        template<typename T>
+        struct IsRowFilterTerm<Added<T>> : std::true_type
+        {
+        };
+
         template<typename... Terms>
         [[nodiscard]] inline QueryTermMetadata BuildQueryMetadata()
         {
@@ -173,6 +210,105 @@ namespace NGIN::ECS
             SortUnique(metadata.Added);
             return metadata;
         }
+
+        /// @brief Column cursor handing out T& (or const T&) per physical row.
+        template<typename T>
+        struct TypedColumn
+        {
+            T* Base {nullptr};
+
+            [[nodiscard]] T& At(NGIN::UIntSize row) const noexcept
+            {
+                if constexpr (std::is_empty_v<std::remove_const_t<T>>)
+                {
+                    return *Base;
+                }
+                else
+                {
+                    return Base[row];
+                }
+            }
+        };
+
+        /// @brief Column cursor for Opt<T>: a pointer per row, null when the archetype lacks T.
+        template<typename T>
+        struct TypedOptionalColumn
+        {
+            const T* Base {nullptr};
+
+            [[nodiscard]] const T* At(NGIN::UIntSize row) const noexcept
+            {
+                if constexpr (std::is_empty_v<T>)
+                {
+                    return Base;
+                }
+                else
+                {
+                    return Base ? Base + row : nullptr;
+                }
+            }
+        };
+
+        template<typename T>
+        [[nodiscard]] inline T* TypedColumnBase(Chunk& chunk, NGIN::UIntSize column) noexcept
+        {
+            if constexpr (std::is_empty_v<std::remove_const_t<T>>)
+            {
+                return EmptyComponentInstance<std::remove_const_t<T>>();
+            }
+            else
+            {
+                return static_cast<T*>(chunk.ComponentPtr(column, 0));
+            }
+        }
+
+        /// @brief Maps a query term to the cursor ForEachTyped passes on; terms without access resolve to nothing.
+        template<typename Term>
+        struct TypedTermAccess
+        {
+            static std::tuple<> Resolve(Chunk&, NGIN::UIntSize) noexcept { return {}; }
+        };
+
+        template<typename T>
+        struct TypedTermAccess<Read<T>>
+        {
+            static std::tuple<TypedColumn<const T>> Resolve(Chunk& chunk, NGIN::UIntSize column) noexcept
+            {
+                return {TypedColumn<const T> {TypedColumnBase<const T>(chunk, column)}};
+            }
+        };
+
+        template<typename T>
+        struct TypedTermAccess<Changed<T>> : TypedTermAccess<Read<T>>
+        {
+        };
+
+        template<typename T>
+        struct TypedTermAccess<Added<T>> : TypedTermAccess<Read<T>>
+        {
+        };
+
+        template<typename T>
+        struct TypedTermAccess<Write<T>>
+        {
+            static std::tuple<TypedColumn<T>> Resolve(Chunk& chunk, NGIN::UIntSize column) noexcept
+            {
+                return {TypedColumn<T> {TypedColumnBase<T>(chunk, column)}};
+            }
+        };
+
+        template<typename T>
+        struct TypedTermAccess<Opt<T>>
+        {
+            static std::tuple<TypedOptionalColumn<T>> Resolve(Chunk& chunk, NGIN::UIntSize column) noexcept
+            {
+                if (column == kInvalidIndex)
+                {
+                    return {TypedOptionalColumn<T> {}};
+                }
+                return {TypedOptionalColumn<T> {TypedColumnBase<const T>(chunk, column)}};
+            }
+        };
     }// namespace detail
 
     class ChunkView;
@@ -245,11 +381,23 @@ namespace NGIN::ECS
                   Chunk* chunk,
                   const NGIN::Containers::Vector<NGIN::UIntSize>* rows,
                   NGIN::UInt64 markTick)
-            : m_archetype(archetype), m_chunk(chunk), m_rows(rows), m_markTick(markTick)
+            : m_archetype(archetype), m_chunk(chunk), m_rows(rows), m_count(rows ? rows->Size() : 0), m_markTick(markTick)
+        {
+        }
+
+        /// @brief Identity view over every row of @p chunk; logical and physical rows coincide.
+        ChunkView(Archetype* archetype, Chunk* chunk, NGIN::UInt64 markTick)
+            : m_archetype(archetype), m_chunk(chunk), m_count(chunk->Count()), m_markTick(markTick)
+        {
+        }
+
+        /// @brief Identity view over the contiguous rows [firstRow, firstRow + rowCount) of @p chunk.
+        ChunkView(Archetype* archetype, Chunk* chunk, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount, NGIN::UInt64 markTick)
+            : m_archetype(archetype), m_chunk(chunk), m_firstRow(firstRow), m_count(rowCount), m_markTick(markTick)
         {
         }
 
-        [[nodiscard]] NGIN::UIntSize Count() const noexcept { return m_rows ? m_rows->Size() : 0; }
+        [[nodiscard]] NGIN::UIntSize Count() const noexcept { return m_count; }
         [[nodiscard]] NGIN::UIntSize count() const noexcept { return Count(); }
 
         [[nodiscard]] RowView Row(NGIN::UIntSize logicalIndex) const
@@ -273,13 +421,13 @@ namespace NGIN::ECS
         }
 
         template<typename T>
-        [[nodiscard]] bool Has() const noexcept
+        [[nodiscard]] bool Has() const
         {
-            return m_archetype->HasComponent(GetTypeId<T>());
+            return m_archetype->Has<T>();
         }
 
         template<typename T>
-        [[nodiscard]] bool has() const noexcept
+        [[nodiscard]] bool has() const
         {
             return Has<T>();
         }
@@ -287,7 +435,7 @@ namespace NGIN::ECS
         template<typename T>
         [[nodiscard]] const T* TryRead(NGIN::UIntSize logicalIndex) const
         {
-            const auto columnIndex = m_archetype->FindColumnIndex(GetTypeId<T>());
+            const auto columnIndex = m_archetype->FindColumn(GetComponentIndex<T>());
             if (columnIndex == kInvalidIndex)
             {
                 return nullptr;
@@ -308,7 +456,7 @@ namespace NGIN::ECS
         template<typename T>
         [[nodiscard]] T* TryWrite(NGIN::UIntSize logicalIndex) const
         {
-            const auto columnIndex = m_archetype->FindColumnIndex(GetTypeId<T>());
+            const auto columnIndex = m_archetype->FindColumn(GetComponentIndex<T>());
             if (columnIndex == kInvalidIndex)
             {
                 return nullptr;
@@ -363,7 +511,7 @@ namespace NGIN::ECS
         template<typename T>
         void MarkChanged(NGIN::UIntSize logicalIndex) const
         {
-            const auto columnIndex = m_archetype->ColumnIndexOf(GetTypeId<T>());
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
             m_chunk->SetChangedTick(columnIndex, PhysicalRow(logicalIndex), m_markTick);
         }
 
@@ -373,30 +521,86 @@ namespace NGIN::ECS
             MarkChanged<T>(logicalIndex);
         }
 
+        /// @brief True when the view's rows are one contiguous run of the chunk, so column spans line up with rows.
+        [[nodiscard]] bool IsDense() const noexcept { return !m_rows || m_count == m_chunk->Count(); }
+
+        /// @brief Entity ids of the view's rows. Requires a dense view.
+        [[nodiscard]] std::span<const EntityId> Entities() const
+        {
+            RequireDense();
+            return {m_chunk->Entities() + m_firstRow, m_count};
+        }
+
+        /// @brief Contiguous read-only storage of component @p T for the view's rows. Requires a dense view.
+        template<typename T>
+        [[nodiscard]] std::span<const T> Column() const
+        {
+            static_assert(!std::is_empty_v<T>, "Tag components have no column storage.");
+            RequireDense();
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
+            return {static_cast<const T*>(m_chunk->ComponentPtr(columnIndex, m_firstRow)), m_count};
+        }
+
+        /// @brief Mutable counterpart of Column(). Does not mark anything changed; see MarkColumnChanged().
+        template<typename T>
+        [[nodiscard]] std::span<T> ColumnMut() const
+        {
+            static_assert(!std::is_empty_v<T>, "Tag components have no column storage.");
+            RequireDense();
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
+            return {static_cast<T*>(m_chunk->ComponentPtr(columnIndex, m_firstRow)), m_count};
+        }
+
+        /// @brief Marks @p T changed on every row of the view in one pass.
+        template<typename T>
+        void MarkColumnChanged() const
+        {
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
+            if (IsDense())
+            {
+                m_chunk->SetChangedTicks(columnIndex, m_firstRow, m_count, m_markTick);
+                return;
+            }
+            for (NGIN::UIntSize logicalIndex = 0; logicalIndex < Count(); ++logicalIndex)
+            {
+                m_chunk->SetChangedTick(columnIndex, PhysicalRow(logicalIndex), m_markTick);
+            }
+        }
+
         template<typename T>
         [[nodiscard]] NGIN::UInt64 AddedTick(NGIN::UIntSize logicalIndex) const
         {
-            const auto columnIndex = m_archetype->ColumnIndexOf(GetTypeId<T>());
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
             return m_chunk->AddedTick(columnIndex, PhysicalRow(logicalIndex));
         }
 
         template<typename T>
         [[nodiscard]] NGIN::UInt64 ChangedTick(NGIN::UIntSize logicalIndex) const
         {
-            const auto columnIndex = m_archetype->ColumnIndexOf(GetTypeId<T>());
+            const auto columnIndex = m_archetype->RequireColumn(GetComponentIndex<T>());
             return m_chunk->ChangedTick(columnIndex, PhysicalRow(logicalIndex));
         }
 
     private:
         [[nodiscard]] NGIN::UIntSize PhysicalRow(NGIN::UIntSize logicalIndex) const noexcept
         {
-            return (*m_rows)[logicalIndex];
+            return m_rows ? (*m_rows)[logicalIndex] : m_firstRow + logicalIndex;
+        }
+
+        void RequireDense() const
+        {
+            if (!IsDense())
+            {
+                throw std::logic_error("Column spans require a view over every row of the chunk.");
+            }
         }
 
     private:
         Archetype*                                   m_archetype {nullptr};
         Chunk*                                       m_chunk {nullptr};
         const NGIN::Containers::Vector<NGIN::UIntSize>* m_rows {nullptr};
+        NGIN::UIntSize                               m_firstRow {0};
+        NGIN::UIntSize                               m_count {0};
         NGIN::UInt64                                 m_markTick {0};
 
         friend class RowView;
@@ -437,59 +641,153 @@ namespace NGIN::ECS
         m_chunkView->template MarkChanged<T>(m_logicalIndex);
     }
 
+    /// @brief Persistent match cache for one query shape against one world.
+    ///
+    /// Remembers which archetypes matched, their per-term and filter column indices, and how many archetypes of the
+    /// world it has already inspected. Each Update() only looks at archetypes created since the last one, so
+    /// iteration through a long-lived state costs in proportion to matched data rather than total archetypes.
+    /// The cache starts over if it is used with a different world or after World::Clear().
+    template<typename... Terms>
+    class QueryState
+    {
+    public:
+        static constexpr NGIN::UIntSize kTermCount = sizeof...(Terms);
+
+        QueryState()
+            : m_metadata(detail::BuildQueryMetadata<Terms...>())
+        {
+        }
+
+        [[nodiscard]] const detail::QueryTermMetadata& Metadata() const noexcept { return m_metadata; }
+
+        /// @brief Matches archetypes the world created since the previous call.
+        void Update(const World& world)
+        {
+            // Versions are unique across worlds, so this also catches a different world at a reused address.
+            if (m_structureVersion != world.StructureVersion())
+            {
+                Reset();
+                m_structureVersion = world.StructureVersion();
+            }
+
+            const auto& archetypes = world.Archetypes();
+            for (; m_seenArchetypes < archetypes.Size(); ++m_seenArchetypes)
+            {
+                const auto* archetype = archetypes[m_seenArchetypes].Get();
+                if (archetype && Matches(*archetype))
+                {
+                    AddMatch(m_seenArchetypes, *archetype);
+                }
+            }
+        }
+
+        [[nodiscard]] NGIN::UIntSize MatchCount() const noexcept { return m_matches.Size(); }
+        [[nodiscard]] NGIN::UIntSize ArchetypeIndexAt(NGIN::UIntSize match) const noexcept { return m_matches[match]; }
+
+        /// @brief Column of each term in matched archetype @p match, in term order; kInvalidIndex for absent
+        /// optional terms and for Without<T>.
+        [[nodiscard]] const NGIN::UIntSize* TermColumns(NGIN::UIntSize match) const noexcept
+        {
+            return m_termColumns.data() + match * kTermCount;
+        }
+
+        [[nodiscard]] const NGIN::UIntSize* ChangedColumns(NGIN::UIntSize match) const noexcept
+        {
+            return m_changedColumns.data() + match * m_metadata.Changed.Size();
+        }
+
+        [[nodiscard]] const NGIN::UIntSize* AddedColumns(NGIN::UIntSize match) const noexcept
+        {
+            return m_addedColumns.data() + match * m_metadata.Added.Size();
+        }
+
+        [[nodiscard]] bool Matches(const Archetype& archetype) const noexcept
+        {
+            const auto& mask = archetype.Mask();
+            return mask.ContainsAll(m_metadata.RequiredMask) && !mask.Intersects(m_metadata.WithoutMask);
+        }
+
+    private:
+        void Reset()
+        {
+            m_matches.Clear();
+            m_termColumns.Clear();
+            m_changedColumns.Clear();
+            m_addedColumns.Clear();
+            m_seenArchetypes = 0;
+        }
+
+        void AddMatch(NGIN::UIntSize archetypeIndex, const Archetype& archetype)
+        {
+            m_matches.EmplaceBack(archetypeIndex);
+            (m_termColumns.EmplaceBack(archetype.FindColumn(GetComponentIndex<typename Terms::Type>())), ...);
+            for (NGIN::UIntSize index = 0; index < m_metadata.Changed.Size(); ++index)
+            {
+                m_changedColumns.EmplaceBack(archetype.ColumnIndexOf(m_metadata.Changed[index]));
+            }
+            for (NGIN::UIntSize index = 0; index < m_metadata.Added.Size(); ++index)
+            {
+                m_addedColumns.EmplaceBack(archetype.ColumnIndexOf(m_metadata.Added[index]));
+            }
+        }
+
+    private:
+        detail::QueryTermMetadata                m_metadata;
+        NGIN::UInt64                             m_structureVersion {0};
+        NGIN::UIntSize                           m_seenArchetypes {0};
+        NGIN::Containers::Vector<NGIN::UIntSize> m_matches;
+        NGIN::Containers::Vector<NGIN::UIntSize> m_termColumns;
+        NGIN::Containers::Vector<NGIN::UIntSize> m_changedColumns;
+        NGIN::Containers::Vector<NGIN::UIntSize> m_addedColumns;
+    };
+
     template<typename... Terms>
     class Query
     {
     public:
         static inline constexpr NGIN::UInt64 kAutoSinceTick = (std::numeric_limits<NGIN::UInt64>::max)();
 
+        /// @brief True when some term filters individual rows (Added<T>/Changed<T>). Queries without row filters
+        /// hand out identity chunk views and never touch the row scratch buffer.
+        static inline constexpr bool kHasRowFilters = (detail::IsRowFilterTerm<Terms>::value || ...);
+
+        /// @brief Default smallest row range handed to one parallel task.
+        static inline constexpr NGIN::UIntSize kDefaultMinBatchRows = 1024;
+
+        using StateType = QueryState<Terms...>;
+
         explicit Query(World& world, NGIN::UInt64 sinceTick = kAutoSinceTick)
+            : m_world(world),
+              m_sinceTick(sinceTick == kAutoSinceTick ? world.PreviousEpoch() : sinceTick)
+        {
+        }
+
+        /// @brief Iterates through a caller-owned state so archetype matching carries over between queries.
+        Query(World& world, StateType& state, NGIN::UInt64 sinceTick = kAutoSinceTick)
             : m_world(world),
               m_sinceTick(sinceTick == kAutoSinceTick ? world.PreviousEpoch() : sinceTick),
-              m_metadata(detail::BuildQueryMetadata<Terms...>())
+              m_externalState(&state)
         {
         }
 
         [[nodiscard]] NGIN::UInt64 SinceTick() const noexcept { return m_sinceTick; }
-        [[nodiscard]] const detail::QueryTermMetadata& Metadata() const noexcept { return m_metadata; }
+        [[nodiscard]] const detail::QueryTermMetadata& Metadata() const noexcept { return State().Metadata(); }
 
         template<typename F>
         void ForChunks(F&& function)
         {
-            for (NGIN::UIntSize archetypeIndex = 0; archetypeIndex < m_world.Archetypes().Size(); ++archetypeIndex)
-            {
-                auto* archetype = m_world.Archetypes()[archetypeIndex].Get();
-                if (!archetype || !Matches(*archetype))
+            VisitChunks([&](Archetype* archetype, Chunk* chunk, NGIN::UIntSize, const NGIN::Containers::Vector<NGIN::UIntSize>* rows) {
+                if (rows)
                 {
-                    continue;
+                    ChunkView view {archetype, chunk, rows, m_world.CurrentEpoch()};
+                    function(view);
                 }
-
-                for (NGIN::UIntSize chunkIndex = 0; chunkIndex < archetype->ChunkCount(); ++chunkIndex)
+                else
                 {
-                    auto* chunk = archetype->GetChunk(chunkIndex);
-                    if (!chunk || chunk->Count() == 0)
-                    {
-                        continue;
-                    }
-
-                    m_rowScratch.Clear();
-                    for (NGIN::UIntSize row = 0; row < chunk->Count(); ++row)
-                    {
-                        if (PassesFilters(*archetype, *chunk, row))
-                        {
-                            m_rowScratch.EmplaceBack(row);
-                        }
-                    }
-
-                    if (m_rowScratch.Size() == 0)
-                    {
-                        continue;
-                    }
-
-                    ChunkView view {archetype, chunk, &m_rowScratch, m_world.CurrentEpoch()};
+                    ChunkView view {archetype, chunk, m_world.CurrentEpoch()};
                     function(view);
                 }
-            }
+            });
         }
 
         template<typename F>
@@ -515,52 +813,270 @@ namespace NGIN::ECS
             ForEach(std::forward<F>(function));
         }
 
+        /// @brief Calls @p function with the row's components, typed from the query terms.
+        ///
+        /// Write<T> is passed as T&, Read<T>/Changed<T>/Added<T> as const T&, and Opt<T> as const T* (null when
+        /// absent); With<T>/Without<T> pass nothing. The function may take the row's EntityId as a leading
+        /// parameter. Column base pointers are resolved once per chunk, so the row loop is plain pointer indexing.
+        /// As with Write<T> elsewhere, rows are not marked changed automatically.
+        template<typename F>
+        void ForEachTyped(F&& function)
+        {
+            VisitChunks([&](Archetype*, Chunk* chunk, NGIN::UIntSize match, const NGIN::Containers::Vector<NGIN::UIntSize>* rows) {
+                auto columns = MakeTypedColumns(*chunk, State().TermColumns(match), std::index_sequence_for<Terms...> {});
+                std::apply([&](const auto&... column) {
+                    auto invoke = [&](NGIN::UIntSize row) {
+                        if constexpr (std::is_invocable_v<F&, decltype(column.At(row))...>)
+                        {
+                            function(column.At(row)...);
+                        }
+                        else
+                        {
+                            static_assert(std::is_invocable_v<F&, EntityId, decltype(column.At(row))...>,
+                                          "ForEachTyped function must accept the query's component references, "
+                                          "optionally preceded by an EntityId.");
+                            function(chunk->EntityAt(row), column.At(row)...);
+                        }
+                    };
+
+                    if (rows)
+                    {
+                        for (NGIN::UIntSize index = 0; index < rows->Size(); ++index)
+                        {
+                            invoke((*rows)[index]);
+                        }
+                    }
+                    else
+                    {
+                        const auto count = chunk->Count();
+                        for (NGIN::UIntSize row = 0; row < count; ++row)
+                        {
+                            invoke(row);
+                        }
+                    }
+                }, columns);
+            });
+        }
+
+        template<typename F>
+        void each_typed(F&& function)
+        {
+            ForEachTyped(std::forward<F>(function));
+        }
+
+        /// @brief Parallel ForChunks over @p pool.
+        ///
+        /// Matched chunks are cut into row ranges of at least @p minBatchRows rows (a chunk smaller than that is one
+        /// range) and the ranges are spread across the pool. @p function receives a ChunkView of one range and is
+        /// called concurrently, so it may only touch the rows it is given; structural changes must be deferred
+        /// through Commands. Row filtering uses per-worker scratch buffers.
+        template<typename F>
+        void ParForChunks(ThreadPool& pool, F&& function, NGIN::UIntSize minBatchRows = kDefaultMinBatchRows)
+        {
+            if (minBatchRows == 0)
+            {
+                throw std::invalid_argument("Parallel batch size must be non-zero.");
+            }
+
+            BuildParallelTasks(minBatchRows);
+            while (m_parallelScratch.Size() < pool.Concurrency())
+            {
+                m_parallelScratch.EmplaceBack();
+            }
+
+            const auto  markTick = m_world.CurrentEpoch();
+            const auto& state    = State();
+            pool.ParallelFor(m_parallelTasks.Size(), [&](NGIN::UIntSize taskIndex, NGIN::UIntSize slot) {
+                const auto& task = m_parallelTasks[taskIndex];
+                if constexpr (!kHasRowFilters)
+                {
+                    ChunkView view {task.Owner, task.Target, task.FirstRow, task.RowCount, markTick};
+                    function(view);
+                }
+                else
+                {
+                    assert(slot < pool.Concurrency());
+                    auto& rows = m_parallelScratch[slot];
+                    if (!CollectFilteredRows(*task.Target,
+                                             task.FirstRow,
+                                             task.RowCount,
+                                             state.ChangedColumns(task.Match),
+                                             state.AddedColumns(task.Match),
+                                             rows))
+                    {
+                        return;
+                    }
+                    ChunkView view {task.Owner, task.Target, &rows, markTick};
+                    function(view);
+                }
+            });
+        }
+
+        /// @brief Parallel ForEach over @p pool; see ParForChunks() for batching and threading rules.
+        template<typename F>
+        void ParForEach(ThreadPool& pool, F&& function, NGIN::UIntSize minBatchRows = kDefaultMinBatchRows)
+        {
+            ParForChunks(pool, [&](const ChunkView& chunkView) {
+                for (NGIN::UIntSize logicalIndex = 0; logicalIndex < chunkView.Count(); ++logicalIndex)
+                {
+                    function(chunkView.Row(logicalIndex));
+                }
+            }, minBatchRows);
+        }
+
     private:
-        [[nodiscard]] bool Matches(const Archetype& archetype) const
+        /// @brief Calls @p visitor(archetype, chunk, match) for every matched, non-empty chunk whose tick summaries
+        /// do not already rule it out; @p match indexes the query state.
+        template<typename V>
+        void VisitMatchedChunks(V&& visitor)
         {
-            const auto& types = archetype.Signature().Types;
-            auto containsAll = [&](const NGIN::Containers::Vector<TypeId>& required) {
-                for (NGIN::UIntSize index = 0; index < required.Size(); ++index)
+            auto& state = State();
+            state.Update(m_world);
+            m_changedCount = state.Metadata().Changed.Size();
+            m_addedCount   = state.Metadata().Added.Size();
+            for (NGIN::UIntSize match = 0; match < state.MatchCount(); ++match)
+            {
+                auto* archetype = m_world.Archetypes()[state.ArchetypeIndexAt(match)].Get();
+                m_changedColumns = state.ChangedColumns(match);
+                m_addedColumns   = state.AddedColumns(match);
+
+                for (NGIN::UIntSize chunkIndex = 0; chunkIndex < archetype->ChunkCount(); ++chunkIndex)
                 {
-                    if (!std::binary_search(types.begin(), types.end(), required[index]))
+                    auto* chunk = archetype->GetChunk(chunkIndex);
+                    if (!chunk || chunk->Count() == 0)
                     {
-                        return false;
+                        continue;
+                    }
+                    if constexpr (kHasRowFilters)
+                    {
+                        if (!ChunkMayPassFilters(*chunk))
+                        {
+                            continue;
+                        }
                     }
+                    visitor(archetype, chunk, match);
                 }
-                return true;
-            };
+            }
+        }
 
-            auto containsNone = [&](const NGIN::Containers::Vector<TypeId>& disallowed) {
-                for (NGIN::UIntSize index = 0; index < disallowed.Size(); ++index)
+        /// @brief Like VisitMatchedChunks(), additionally passing the filtered row list (null when every row of the
+        /// chunk is visited) and skipping chunks where no row passes.
+        template<typename V>
+        void VisitChunks(V&& visitor)
+        {
+            VisitMatchedChunks([&](Archetype* archetype, Chunk* chunk, NGIN::UIntSize match) {
+                if constexpr (!kHasRowFilters)
+                {
+                    visitor(archetype, chunk, match, nullptr);
+                }
+                else
                 {
-                    if (std::binary_search(types.begin(), types.end(), disallowed[index]))
+                    if (CollectFilteredRows(*chunk, 0, chunk->Count(), m_changedColumns, m_addedColumns, m_rowScratch))
                     {
-                        return false;
+                        visitor(archetype, chunk, match, &m_rowScratch);
                     }
                 }
-                return true;
-            };
+            });
+        }
+
+        /// @brief One unit of parallel work: a row range of one matched chunk.
+        struct ParallelTask
+        {
+            Archetype*     Owner {nullptr};
+            Chunk*         Target {nullptr};
+            NGIN::UIntSize Match {0};
+            NGIN::UIntSize FirstRow {0};
+            NGIN::UIntSize RowCount {0};
+        };
+
+        void BuildParallelTasks(NGIN::UIntSize minBatchRows)
+        {
+            m_parallelTasks.Clear();
+            VisitMatchedChunks([&](Archetype* archetype, Chunk* chunk, NGIN::UIntSize match) {
+                const auto count   = chunk->Count();
+                const auto batches = (std::max)(NGIN::UIntSize {1}, count / minBatchRows);
+                const auto share   = count / batches;
+                const auto extra   = count % batches;
+                NGIN::UIntSize firstRow = 0;
+                for (NGIN::UIntSize batch = 0; batch < batches; ++batch)
+                {
+                    const auto rows = share + (batch < extra ? 1 : 0);
+                    m_parallelTasks.EmplaceBack(ParallelTask {archetype, chunk, match, firstRow, rows});
+                    firstRow += rows;
+                }
+            });
+        }
 
-            return containsAll(m_metadata.Required) &&
-                   containsAll(m_metadata.With) &&
-                   containsNone(m_metadata.Without);
+        template<std::size_t... Indices>
+        [[nodiscard]] static auto MakeTypedColumns(Chunk& chunk, const NGIN::UIntSize* termColumns, std::index_sequence<Indices...>)
+        {
+            return std::tuple_cat(detail::TypedTermAccess<Terms>::Resolve(chunk, termColumns[Indices])...);
         }
 
-        [[nodiscard]] bool PassesFilters(const Archetype& archetype, const Chunk& chunk, NGIN::UIntSize row) const
+        [[nodiscard]] StateType& State() noexcept { return m_externalState ? *m_externalState : m_ownedState; }
+        [[nodiscard]] const StateType& State() const noexcept
         {
-            for (NGIN::UIntSize index = 0; index < m_metadata.Changed.Size(); ++index)
+            return m_externalState ? *m_externalState : m_ownedState;
+        }
+
+        /// @brief Fills @p rows with the rows of [firstRow, firstRow + rowCount) passing the tick filters; false
+        /// when none do. Only reads shared state, so parallel iteration calls it with per-worker row buffers.
+        bool CollectFilteredRows(const Chunk&                              chunk,
+                                 NGIN::UIntSize                            firstRow,
+                                 NGIN::UIntSize                            rowCount,
+                                 const NGIN::UIntSize*                     changedColumns,
+                                 const NGIN::UIntSize*                     addedColumns,
+                                 NGIN::Containers::Vector<NGIN::UIntSize>& rows) const
+        {
+            rows.Clear();
+            for (NGIN::UIntSize row = firstRow; row < firstRow + rowCount; ++row)
+            {
+                if (PassesFilters(chunk, row, changedColumns, addedColumns))
+                {
+                    rows.EmplaceBack(row);
+                }
+            }
+            return rows.Size() != 0;
+        }
+
+        /// @brief Rejects a whole chunk when a filtered column has no tick newer than the baseline.
+        [[nodiscard]] bool ChunkMayPassFilters(const Chunk& chunk) const noexcept
+        {
+            for (NGIN::UIntSize index = 0; index < m_changedCount; ++index)
             {
-                const auto columnIndex = archetype.ColumnIndexOf(m_metadata.Changed[index]);
-                if (chunk.ChangedTick(columnIndex, row) <= m_sinceTick)
+                if (chunk.MaxChangedTick(m_changedColumns[index]) <= m_sinceTick)
                 {
                     return false;
                 }
             }
 
-            for (NGIN::UIntSize index = 0; index < m_metadata.Added.Size(); ++index)
+            for (NGIN::UIntSize index = 0; index < m_addedCount; ++index)
+            {
+                if (chunk.MaxAddedTick(m_addedColumns[index]) <= m_sinceTick)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] bool PassesFilters(const Chunk&          chunk,
+                                         NGIN::UIntSize        row,
+                                         const NGIN::UIntSize* changedColumns,
+                                         const NGIN::UIntSize* addedColumns) const noexcept
+        {
+            for (NGIN::UIntSize index = 0; index < m_changedCount; ++index)
+            {
+                if (chunk.ChangedTick(changedColumns[index], row) <= m_sinceTick)
+                {
+                    return false;
+                }
+            }
+
+            for (NGIN::UIntSize index = 0; index < m_addedCount; ++index)
             {
-                const auto columnIndex = archetype.ColumnIndexOf(m_metadata.Added[index]);
-                if (chunk.AddedTick(columnIndex, row) <= m_sinceTick)
+                if (chunk.AddedTick(addedColumns[index], row) <= m_sinceTick)
                 {
                     return false;
                 }
@@ -572,7 +1088,14 @@ namespace NGIN::ECS
     private:
         World&                                           m_world;
         NGIN::UInt64                                     m_sinceTick {0};
-        detail::QueryTermMetadata                        m_metadata;
+        StateType                                        m_ownedState;
+        StateType*                                       m_externalState {nullptr};
         NGIN::Containers::Vector<NGIN::UIntSize>         m_rowScratch;
+        NGIN::Containers::Vector<ParallelTask>           m_parallelTasks;
+        NGIN::Containers::Vector<NGIN::Containers::Vector<NGIN::UIntSize>> m_parallelScratch;
+        const NGIN::UIntSize*                            m_changedColumns {nullptr};
+        const NGIN::UIntSize*                            m_addedColumns {nullptr};
+        NGIN::UIntSize                                   m_changedCount {0};
+        NGIN::UIntSize                                   m_addedCount {0};
     };
 }
@@ -5,11 +5,18 @@
 #include <NGIN/ECS/TypeRegistry.hpp>
 #include <NGIN/ECS/Query.hpp>
 #include <NGIN/ECS/Commands.hpp>
+#include <NGIN/ECS/ThreadPool.hpp>
 #include <NGIN/Containers/Vector.hpp>
 #include <NGIN/Meta/FunctionTraits.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -39,8 +46,33 @@ namespace NGIN::ECS
         NGIN::Containers::Vector<TypeId>                 Reads;
         NGIN::Containers::Vector<TypeId>                 Writes;
         bool                                             Exclusive {false};
+        /// @brief Records into its own Commands buffer, flushed at the end of the system's stage.
+        bool                                             UsesCommands {false};
         std::function<void(World&, Commands&, NGIN::UInt64 sinceTick)> Run;
         NGIN::UInt64                                     LastRunTick {0};
+        /// @brief Systems or sets (by name) this system must run after / before.
+        std::vector<std::string>                         RunAfter;
+        std::vector<std::string>                         RunBefore;
+        /// @brief Named sets this system belongs to; constraints naming a set apply to every member.
+        std::vector<std::string>                         Sets;
+
+        SystemDescriptor& After(std::string target)
+        {
+            RunAfter.push_back(std::move(target));
+            return *this;
+        }
+
+        SystemDescriptor& Before(std::string target)
+        {
+            RunBefore.push_back(std::move(target));
+            return *this;
+        }
+
+        SystemDescriptor& InSet(std::string set)
+        {
+            Sets.push_back(std::move(set));
+            return *this;
+        }
     };
 
     namespace detail
@@ -55,6 +87,11 @@ namespace NGIN::ECS
             SortUnique(destination);
         }
 
+        /// @brief Per-system state for parameters that keep nothing between runs.
+        struct NoParamState
+        {
+        };
+
         template<typename Arg>
         struct SystemParamBinder;
 
@@ -62,6 +99,7 @@ namespace NGIN::ECS
         struct SystemParamBinder<Query<Terms...>>
         {
             using StorageType = Query<Terms...>;
+            using StateType   = QueryState<Terms...>;
 
             static void Describe(SystemDescriptor& descriptor)
             {
@@ -70,9 +108,9 @@ namespace NGIN::ECS
                 AppendUnique(descriptor.Writes, metadata.Writes);
             }
 
-            static StorageType Create(World& world, Commands&, NGIN::UInt64 sinceTick)
+            static StorageType Create(World& world, Commands&, NGIN::UInt64 sinceTick, StateType& state)
             {
-                return StorageType {world, sinceTick};
+                return StorageType {world, state, sinceTick};
             }
         };
 
@@ -90,13 +128,14 @@ namespace NGIN::ECS
         struct SystemParamBinder<Commands&>
         {
             using StorageType = std::reference_wrapper<Commands>;
+            using StateType   = NoParamState;
 
             static void Describe(SystemDescriptor& descriptor)
             {
-                descriptor.Exclusive = true;
+                descriptor.UsesCommands = true;
             }
 
-            static StorageType Create(World&, Commands& commands, NGIN::UInt64)
+            static StorageType Create(World&, Commands& commands, NGIN::UInt64, StateType&)
             {
                 return std::ref(commands);
             }
@@ -106,13 +145,14 @@ namespace NGIN::ECS
         struct SystemParamBinder<ExclusiveWorld>
         {
             using StorageType = ExclusiveWorld;
+            using StateType   = NoParamState;
 
             static void Describe(SystemDescriptor& descriptor)
             {
                 descriptor.Exclusive = true;
             }
 
-            static StorageType Create(World& world, Commands&, NGIN::UInt64)
+            static StorageType Create(World& world, Commands&, NGIN::UInt64, StateType&)
             {
                 return ExclusiveWorld {world};
             }
@@ -136,25 +176,39 @@ namespace NGIN::ECS
             SortUnique(descriptor.Writes);
         }
 
-        template<typename Callable, typename Traits, std::size_t... Indices>
+        template<typename Traits, typename Indices>
+        struct SystemParamStates;
+
+        template<typename Traits, std::size_t... Indices>
+        struct SystemParamStates<Traits, std::index_sequence<Indices...>>
+        {
+            using Type = std::tuple<typename SystemParamBinder<typename Traits::template ArgNType<Indices>>::StateType...>;
+        };
+
+        template<typename Callable, typename Traits, typename States, std::size_t... Indices>
         auto MakeBoundArgs(World& world,
                            Commands& commands,
                            NGIN::UInt64 sinceTick,
+                           States& states,
                            std::index_sequence<Indices...>)
         {
             return std::tuple<typename SystemParamBinder<typename Traits::template ArgNType<Indices>>::StorageType...> {
-                SystemParamBinder<typename Traits::template ArgNType<Indices>>::Create(world, commands, sinceTick)...
+                SystemParamBinder<typename Traits::template ArgNType<Indices>>::Create(world,
+                                                                                       commands,
+                                                                                       sinceTick,
+                                                                                       std::get<Indices>(states))...
             };
         }
 
-        template<typename Callable, typename Traits, std::size_t... Indices>
+        template<typename Callable, typename Traits, typename States, std::size_t... Indices>
         void InvokeSystem(Callable& callable,
                           World& world,
                           Commands& commands,
                           NGIN::UInt64 sinceTick,
+                          States& states,
                           std::index_sequence<Indices...>)
         {
-            auto args = MakeBoundArgs<Callable, Traits>(world, commands, sinceTick, std::index_sequence<Indices...> {});
+            auto args = MakeBoundArgs<Callable, Traits>(world, commands, sinceTick, states, std::index_sequence<Indices...> {});
             std::apply([&](auto&&... boundArgs) {
                 callable(std::forward<decltype(boundArgs)>(boundArgs)...);
             }, args);
@@ -171,11 +225,14 @@ namespace NGIN::ECS
             DescribeSystemArgs<Fn, Traits>(descriptor, std::make_index_sequence<Traits::NUM_ARGS> {});
             descriptor.Exclusive = descriptor.Exclusive || forceExclusive;
 
-            descriptor.Run = [fn = std::forward<Callable>(callable)](World& world, Commands& commands, NGIN::UInt64 sinceTick) mutable {
+            // Parameter states (query match caches) live in the closure so they persist across runs.
+            using States = typename SystemParamStates<Traits, std::make_index_sequence<Traits::NUM_ARGS>>::Type;
+            descriptor.Run = [fn = std::forward<Callable>(callable), states = States {}](World& world, Commands& commands, NGIN::UInt64 sinceTick) mutable {
                 InvokeSystem<Fn, Traits>(fn,
                                          world,
                                          commands,
                                          sinceTick,
+                                         states,
                                          std::make_index_sequence<Traits::NUM_ARGS> {});
             };
             return descriptor;
@@ -194,11 +251,20 @@ namespace NGIN::ECS
         return detail::MakeSystemDescriptor(name, std::forward<Callable>(callable), true);
     }
 
+    /// @brief Builds a dependency graph over registered systems and runs it.
+    ///
+    /// Edges come from explicit Before/After constraints (against system names or set names) and, for every pair of
+    /// conflicting systems not already ordered by those, from registration order; edges implied by a longer path are
+    /// then pruned. Stages are the longest-path levels of that graph. Without a thread pool the stages run in order on
+    /// the calling thread. With one, systems are dispatched as soon as their own predecessors finish, longest remaining
+    /// critical path first (weighted by each system's last measured run time). Exclusive systems run alone, and command
+    /// buffers are flushed after the stages that filled them, so both act as sync points.
     class NGIN_ECS_API Scheduler
     {
     public:
         Scheduler() = default;
 
+        /// @brief Adds @p system; it joins the stage plan at the next Build() and is skipped by Run() until then.
         NGIN::UInt32 Register(const SystemDescriptor& system)
         {
             const auto id = static_cast<NGIN::UInt32>(m_systems.Size());
@@ -206,50 +272,80 @@ namespace NGIN::ECS
             return id;
         }
 
+        /// @brief Rebuilds the dependency graph and stage plan. Throws std::logic_error when constraints form a
+        /// cycle or name no registered system or set.
         void Build()
         {
-            m_stages.clear();
-            m_stageBySystem.clear();
-            m_stageBySystem.resize(m_systems.Size(), 0);
+            const auto count = m_systems.Size();
+            m_successors.assign(count, {});
+            m_predecessorCounts.assign(count, 0);
+            m_lastRunNanoseconds.resize(count, 0);
+            while (m_commandBuffers.size() < count)
+            {
+                m_commandBuffers.push_back(std::make_unique<Commands>());
+            }
+            m_reachable.assign(count, std::vector<bool>(count, false));
 
-            for (NGIN::UIntSize systemIndex = 0; systemIndex < m_systems.Size(); ++systemIndex)
+            for (NGIN::UIntSize systemIndex = 0; systemIndex < count; ++systemIndex)
             {
-                int stageIndex = 0;
-                for (NGIN::UIntSize previousIndex = 0; previousIndex < systemIndex; ++previousIndex)
+                const auto& system = m_systems[systemIndex];
+                for (const auto& target : system.RunAfter)
                 {
-                    if (Conflicts(m_systems[previousIndex], m_systems[systemIndex]) ||
-                        m_systems[previousIndex].Exclusive || m_systems[systemIndex].Exclusive)
+                    for (const auto other : ResolveTarget(target, system))
                     {
-                        stageIndex = std::max(stageIndex, m_stageBySystem[previousIndex] + 1);
+                        AddEdge(other, systemIndex);
                     }
                 }
-
-                if (m_stages.size() <= static_cast<std::size_t>(stageIndex))
+                for (const auto& target : system.RunBefore)
                 {
-                    m_stages.resize(static_cast<std::size_t>(stageIndex + 1));
+                    for (const auto other : ResolveTarget(target, system))
+                    {
+                        AddEdge(systemIndex, other);
+                    }
                 }
+            }
 
-                m_stageBySystem[systemIndex] = stageIndex;
-                m_stages[static_cast<std::size_t>(stageIndex)].push_back(static_cast<int>(systemIndex));
+            for (NGIN::UIntSize later = 0; later < count; ++later)
+            {
+                for (NGIN::UIntSize earlier = 0; earlier < later; ++earlier)
+                {
+                    const bool ordered = m_systems[earlier].Exclusive || m_systems[later].Exclusive ||
+                                         Conflicts(m_systems[earlier], m_systems[later]);
+                    if (ordered && !m_reachable[later][earlier])
+                    {
+                        AddEdge(earlier, later);
+                    }
+                }
             }
+
+            PruneTransitiveEdges();
+            BuildStages();
         }
 
+        /// @brief Runs independent systems concurrently on @p pool; null (the default) runs the stage plan in order
+        /// on the calling thread. The pool must outlive every Run() that uses it.
+        void SetThreadPool(ThreadPool* pool) noexcept { m_threadPool = pool; }
+        [[nodiscard]] ThreadPool* GetThreadPool() const noexcept { return m_threadPool; }
+
+        /// @brief Runs every system once. Each system records into its own command buffer; buffers are flushed in
+        /// registration order after the stage that filled them, before any later stage starts. If a system throws,
+        /// every buffer is cleared and unbound before the exception propagates, so none is left holding operations
+        /// for @p world.
         void Run(World& world)
         {
             world.NextEpoch();
-            Commands commands;
-            for (auto& stage : m_stages)
+            for (auto& buffer: m_commandBuffers)
             {
-                for (const int systemIndex : stage)
-                {
-                    auto& system = m_systems[static_cast<NGIN::UIntSize>(systemIndex)];
-                    if (system.Run)
-                    {
-                        system.Run(world, commands, system.LastRunTick);
-                        system.LastRunTick = world.CurrentEpoch();
-                    }
-                }
-                commands.Flush(world);
+                buffer->Bind(&world);
+            }
+
+            try
+            {
+                RunStages(world);
+            } catch (...)
+            {
+                DiscardCommands();
+                throw;
             }
         }
 
@@ -263,7 +359,345 @@ namespace NGIN::ECS
             return m_stages[stageIndex];
         }
 
+        /// @brief Systems that directly depend on @p systemIndex; edges implied by a longer path are pruned.
+        [[nodiscard]] const std::vector<NGIN::UIntSize>& SuccessorsOf(NGIN::UIntSize systemIndex) const
+        {
+            return m_successors[systemIndex];
+        }
+
+        /// @brief True when the graph orders @p before ahead of @p after, directly or transitively.
+        [[nodiscard]] bool RunsBefore(NGIN::UIntSize before, NGIN::UIntSize after) const
+        {
+            return m_reachable[before][after];
+        }
+
     private:
+        void RunStages(World& world)
+        {
+            if (!m_threadPool)
+            {
+                for (NGIN::UIntSize stage = 0; stage < m_stages.size(); ++stage)
+                {
+                    for (const int systemIndex : m_stages[stage])
+                    {
+                        RunSystem(static_cast<NGIN::UIntSize>(systemIndex), world);
+                    }
+                    FlushCommands(stage, stage + 1, world);
+                }
+                return;
+            }
+
+            // Exclusive systems are ordered against everything, so each one is alone in its stage. They and stages
+            // holding command producers end a segment; inside a segment, systems are dispatched purely by dependency.
+            NGIN::UIntSize stage = 0;
+            while (stage < m_stages.size())
+            {
+                if (IsExclusiveStage(stage))
+                {
+                    RunSystem(static_cast<NGIN::UIntSize>(m_stages[stage].front()), world);
+                    FlushCommands(stage, stage + 1, world);
+                    ++stage;
+                    continue;
+                }
+
+                auto segmentEnd = stage;
+                do
+                {
+                    ++segmentEnd;
+                } while (segmentEnd < m_stages.size() && !IsExclusiveStage(segmentEnd) &&
+                         !HasCommandProducer(segmentEnd - 1));
+                RunSegment(stage, segmentEnd, world);
+                FlushCommands(stage, segmentEnd, world);
+                stage = segmentEnd;
+            }
+        }
+
+        /// @brief Drops whatever an interrupted Run() left in the command buffers and unbinds them.
+        void DiscardCommands() noexcept
+        {
+            for (auto& buffer: m_commandBuffers)
+            {
+                try
+                {
+                    buffer->Clear();
+                } catch (...)
+                {
+                    // Out of memory while giving reservations back; those ids just stay reserved.
+                }
+                buffer->Bind(nullptr);
+            }
+        }
+
+        [[nodiscard]] std::vector<NGIN::UIntSize> ResolveTarget(const std::string& target,
+                                                                const SystemDescriptor& constrained) const
+        {
+            std::vector<NGIN::UIntSize> matches;
+            for (NGIN::UIntSize index = 0; index < m_systems.Size(); ++index)
+            {
+                const auto& system = m_systems[index];
+                if (&system == &constrained)
+                {
+                    continue;
+                }
+                const bool inSet = std::find(system.Sets.begin(), system.Sets.end(), target) != system.Sets.end();
+                if (inSet || target == system.Name)
+                {
+                    matches.push_back(index);
+                }
+            }
+
+            const bool constrainedInSet =
+                std::find(constrained.Sets.begin(), constrained.Sets.end(), target) != constrained.Sets.end();
+            if (matches.empty() && !constrainedInSet && target != constrained.Name)
+            {
+                throw std::logic_error("Ordering constraint on system '" + std::string(constrained.Name) +
+                                       "' names unknown system or set '" + target + "'.");
+            }
+            return matches;
+        }
+
+        void AddEdge(NGIN::UIntSize from, NGIN::UIntSize to)
+        {
+            if (m_reachable[from][to])
+            {
+                return;
+            }
+            if (from == to || m_reachable[to][from])
+            {
+                throw std::logic_error("System ordering cycle between '" + std::string(m_systems[from].Name) +
+                                       "' and '" + std::string(m_systems[to].Name) + "'.");
+            }
+
+            m_successors[from].push_back(to);
+            ++m_predecessorCounts[to];
+            for (NGIN::UIntSize source = 0; source < m_systems.Size(); ++source)
+            {
+                if (source != from && !m_reachable[source][from])
+                {
+                    continue;
+                }
+                m_reachable[source][to] = true;
+                for (NGIN::UIntSize target = 0; target < m_systems.Size(); ++target)
+                {
+                    if (m_reachable[to][target])
+                    {
+                        m_reachable[source][target] = true;
+                    }
+                }
+            }
+        }
+
+        /// @brief Transitive reduction: drops every edge from -> to that another direct successor of `from` already
+        /// orders, since AddEdge() only skips edges implied at the time they are added.
+        void PruneTransitiveEdges()
+        {
+            std::fill(m_predecessorCounts.begin(), m_predecessorCounts.end(), 0);
+            for (auto& successors: m_successors)
+            {
+                const auto direct = successors;
+                std::erase_if(successors, [&](NGIN::UIntSize to) {
+                    return std::any_of(direct.begin(), direct.end(), [&](NGIN::UIntSize via) {
+                        return via != to && m_reachable[via][to];
+                    });
+                });
+                for (const auto to: successors)
+                {
+                    ++m_predecessorCounts[to];
+                }
+            }
+        }
+
+        void BuildStages()
+        {
+            const auto count = m_systems.Size();
+            m_stages.clear();
+            m_stageBySystem.assign(count, 0);
+
+            // Kahn's algorithm over registration order; each system lands one level after its deepest predecessor.
+            std::vector<NGIN::UIntSize> pending(m_predecessorCounts.begin(), m_predecessorCounts.end());
+            std::vector<NGIN::UIntSize> order;
+            order.reserve(count);
+            for (NGIN::UIntSize index = 0; index < count; ++index)
+            {
+                if (pending[index] == 0)
+                {
+                    order.push_back(index);
+                }
+            }
+            for (NGIN::UIntSize cursor = 0; cursor < order.size(); ++cursor)
+            {
+                const auto systemIndex = order[cursor];
+                for (const auto successor : m_successors[systemIndex])
+                {
+                    m_stageBySystem[successor] = std::max(m_stageBySystem[successor], m_stageBySystem[systemIndex] + 1);
+                    if (--pending[successor] == 0)
+                    {
+                        order.push_back(successor);
+                    }
+                }
+            }
+
+            for (NGIN::UIntSize systemIndex = 0; systemIndex < count; ++systemIndex)
+            {
+                const auto stageIndex = static_cast<std::size_t>(m_stageBySystem[systemIndex]);
+                if (m_stages.size() <= stageIndex)
+                {
+                    m_stages.resize(stageIndex + 1);
+                }
+                m_stages[stageIndex].push_back(static_cast<int>(systemIndex));
+            }
+        }
+
+        [[nodiscard]] bool IsExclusiveStage(NGIN::UIntSize stage) const
+        {
+            return m_stages[stage].size() == 1 &&
+                   m_systems[static_cast<NGIN::UIntSize>(m_stages[stage].front())].Exclusive;
+        }
+
+        [[nodiscard]] bool HasCommandProducer(NGIN::UIntSize stage) const
+        {
+            for (const int systemIndex : m_stages[stage])
+            {
+                if (m_systems[static_cast<NGIN::UIntSize>(systemIndex)].UsesCommands)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief Applies the command buffers of every system in stages [firstStage, lastStage), lowest registration
+        /// index first, so the outcome does not depend on which thread finished first.
+        void FlushCommands(NGIN::UIntSize firstStage, NGIN::UIntSize lastStage, World& world)
+        {
+            // Systems registered since the last Build() have no stage (or buffer) yet and never ran.
+            for (NGIN::UIntSize systemIndex = 0; systemIndex < m_stageBySystem.size(); ++systemIndex)
+            {
+                const auto stage = static_cast<NGIN::UIntSize>(m_stageBySystem[systemIndex]);
+                if (stage >= firstStage && stage < lastStage)
+                {
+                    m_commandBuffers[systemIndex]->Flush(world);
+                }
+            }
+        }
+
+        /// @brief Dispatches the systems of stages [firstStage, lastStage) on the pool by dependency.
+        void RunSegment(NGIN::UIntSize firstStage, NGIN::UIntSize lastStage, World& world)
+        {
+            std::vector<NGIN::UIntSize> members;
+            for (auto stage = firstStage; stage < lastStage; ++stage)
+            {
+                for (const int systemIndex : m_stages[stage])
+                {
+                    members.push_back(static_cast<NGIN::UIntSize>(systemIndex));
+                }
+            }
+            if (members.size() == 1)
+            {
+                RunSystem(members.front(), world);
+                return;
+            }
+
+            // Predecessors outside the segment have already run; only count the ones inside it. Members are in
+            // stage order, so walking them backwards visits successors first for the critical-path pass.
+            std::vector<bool> inSegment(m_systems.Size(), false);
+            for (const auto member : members)
+            {
+                inSegment[member] = true;
+            }
+
+            std::vector<NGIN::UIntSize> pending(m_systems.Size(), 0);
+            std::vector<NGIN::UInt64>   criticalPath(m_systems.Size(), 0);
+            for (auto member = members.rbegin(); member != members.rend(); ++member)
+            {
+                NGIN::UInt64 longestTail = 0;
+                for (const auto successor : m_successors[*member])
+                {
+                    if (!inSegment[successor])
+                    {
+                        continue;
+                    }
+                    ++pending[successor];
+                    longestTail = std::max(longestTail, criticalPath[successor]);
+                }
+                criticalPath[*member] = longestTail + std::max<NGIN::UInt64>(1, m_lastRunNanoseconds[*member]);
+            }
+
+            std::mutex                  mutex;
+            std::condition_variable     wake;
+            std::vector<NGIN::UIntSize> ready;
+            auto                        remaining = members.size();
+            bool                        aborted   = false;
+            for (const auto member : members)
+            {
+                if (pending[member] == 0)
+                {
+                    ready.push_back(member);
+                }
+            }
+
+            m_threadPool->ParallelFor(m_threadPool->Concurrency(), [&](NGIN::UIntSize, NGIN::UIntSize) {
+                for (;;)
+                {
+                    NGIN::UIntSize systemIndex = 0;
+                    {
+                        std::unique_lock lock(mutex);
+                        wake.wait(lock, [&] { return aborted || remaining == 0 || !ready.empty(); });
+                        if (aborted || remaining == 0)
+                        {
+                            return;
+                        }
+                        auto next = std::max_element(ready.begin(), ready.end(), [&](auto left, auto right) {
+                            return criticalPath[left] < criticalPath[right];
+                        });
+                        systemIndex = *next;
+                        ready.erase(next);
+                    }
+
+                    try
+                    {
+                        RunSystem(systemIndex, world);
+                    }
+                    catch (...)
+                    {
+                        {
+                            std::lock_guard lock(mutex);
+                            aborted = true;
+                        }
+                        wake.notify_all();
+                        throw;
+                    }
+
+                    {
+                        std::lock_guard lock(mutex);
+                        --remaining;
+                        for (const auto successor : m_successors[systemIndex])
+                        {
+                            if (inSegment[successor] && --pending[successor] == 0)
+                            {
+                                ready.push_back(successor);
+                            }
+                        }
+                    }
+                    wake.notify_all();
+                }
+            });
+        }
+
+        void RunSystem(NGIN::UIntSize systemIndex, World& world)
+        {
+            auto& system = m_systems[systemIndex];
+            if (!system.Run)
+            {
+                return;
+            }
+            const auto begin = std::chrono::steady_clock::now();
+            system.Run(world, *m_commandBuffers[systemIndex], system.LastRunTick);
+            system.LastRunTick = world.CurrentEpoch();
+            m_lastRunNanoseconds[systemIndex] = static_cast<NGIN::UInt64>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+        }
+
         [[nodiscard]] static bool Intersects(const NGIN::Containers::Vector<TypeId>& left,
                                              const NGIN::Containers::Vector<TypeId>& right)
         {
@@ -289,7 +723,13 @@ namespace NGIN::ECS
 
     private:
         NGIN::Containers::Vector<SystemDescriptor> m_systems;
+        std::vector<std::vector<NGIN::UIntSize>>   m_successors;
+        std::vector<NGIN::UIntSize>                m_predecessorCounts;
+        std::vector<std::vector<bool>>             m_reachable;
+        std::vector<NGIN::UInt64>                  m_lastRunNanoseconds;
+        std::vector<std::unique_ptr<Commands>>     m_commandBuffers; ///< One per system, kept across runs.
         std::vector<int>                           m_stageBySystem;
         std::vector<std::vector<int>>              m_stages;
+        ThreadPool*                                m_threadPool {nullptr};
     };
 }
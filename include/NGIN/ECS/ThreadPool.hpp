@@ -0,0 +1,75 @@
+#pragma once
+
+#include <NGIN/ECS/Export.hpp>
+#include <NGIN/Primitives.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NGIN::ECS
+{
+    /// @brief Fixed set of worker threads running fork/join loops with work stealing.
+    ///
+    /// ParallelFor() splits the index range evenly across all participants (the workers plus the calling thread).
+    /// Each participant consumes its own range from the front; once it runs dry it steals the back half of the next
+    /// non-empty range it finds. The call returns once every index has run, rethrowing the first exception thrown by
+    /// a task. Calls made from inside a running task of the same pool execute inline on that task's thread and slot;
+    /// calls made from inside a task of a different pool execute inline as slot 0.
+    class NGIN_ECS_API ThreadPool
+    {
+    public:
+        /// @brief Task callback: (task index, participant slot in [0, Concurrency())).
+        using TaskFunction = std::function<void(NGIN::UIntSize, NGIN::UIntSize)>;
+
+        /// @brief Starts @p workerCount background threads; 0 picks hardware concurrency minus the calling thread.
+        explicit ThreadPool(NGIN::UIntSize workerCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&)                 = delete;
+        ThreadPool& operator=(ThreadPool&&)      = delete;
+
+        [[nodiscard]] NGIN::UIntSize WorkerCount() const noexcept { return m_workers.size(); }
+
+        /// @brief Number of participants in a ParallelFor: the workers plus the calling thread.
+        [[nodiscard]] NGIN::UIntSize Concurrency() const noexcept { return m_workers.size() + 1; }
+
+        /// @brief Runs @p task for every index in [0, taskCount) and blocks until all have finished.
+        void ParallelFor(NGIN::UIntSize taskCount, const TaskFunction& task);
+
+    private:
+        struct alignas(64) TaskRange
+        {
+            std::mutex     Mutex;
+            NGIN::UIntSize Begin {0};
+            NGIN::UIntSize End {0};
+        };
+
+        void WorkerLoop(NGIN::UIntSize slot);
+        void RunTasks(NGIN::UIntSize slot);
+        [[nodiscard]] bool TakeOwn(NGIN::UIntSize slot, NGIN::UIntSize& taskIndex);
+        [[nodiscard]] bool Steal(NGIN::UIntSize slot);
+
+    private:
+        std::vector<std::thread>     m_workers;
+        std::unique_ptr<TaskRange[]> m_ranges;
+
+        std::mutex              m_dispatchMutex; ///< Serializes ParallelFor calls from different threads.
+        std::mutex              m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+        NGIN::UInt64            m_generation {0};
+        NGIN::UIntSize          m_busyWorkers {0};
+        bool                    m_stopping {false};
+
+        const TaskFunction* m_task {nullptr};
+        std::exception_ptr  m_error;
+        std::mutex          m_errorMutex;
+    };
+}// namespace NGIN::ECS
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <NGIN/ECS/Export.hpp>
 #include <NGIN/Primitives.hpp>
 #include <NGIN/Hashing/FNV.hpp>
 #include <NGIN/Meta/TypeName.hpp>
 #include <NGIN/Meta/TypeTraits.hpp>
 
 #include <cstring>
+#include <limits>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -14,6 +16,11 @@ namespace NGIN::ECS
 {
     using TypeId = NGIN::UInt64;
 
+    /// @brief Small dense per-process index for a component type, assigned on first use.
+    using ComponentIndex = NGIN::UInt32;
+
+    inline constexpr ComponentIndex kInvalidComponentIndex = (std::numeric_limits<ComponentIndex>::max)();
+
     using CopyConstructFn     = void (*)(void* destination, const void* source);
     using MoveConstructFn     = void (*)(void* destination, void* source);
     using RelocateConstructFn = void (*)(void* destination, void* source);
@@ -29,14 +36,60 @@ namespace NGIN::ECS
         return kId;
     }
 
+    /// @brief Returns the dense index for @p typeId, assigning the next free one on first sight. Thread-safe.
+    ///
+    /// Lives in the library so every module that shares it agrees on the same indices.
+    [[nodiscard]] NGIN_ECS_API ComponentIndex RegisterComponentIndex(TypeId typeId);
+
+    template<typename T>
+    [[nodiscard]] inline ComponentIndex GetComponentIndex()
+    {
+        static const ComponentIndex kIndex = RegisterComponentIndex(GetTypeId<T>());
+        return kIndex;
+    }
+
+    /// @brief Returns the dense index for the ordered component pack hashed as @p packKey, assigning the next free one
+    /// on first sight. Thread-safe.
+    [[nodiscard]] NGIN_ECS_API NGIN::UInt32 RegisterComponentPackIndex(NGIN::UInt64 packKey);
+
+    /// @brief Dense per-process index of the ordered pack {Cs...}; {A, B} and {B, A} get different indices.
+    template<typename... Cs>
+    [[nodiscard]] inline NGIN::UInt32 GetComponentPackIndex()
+    {
+        static const NGIN::UInt32 kIndex = [] {
+            const TypeId ids[] = {GetTypeId<Cs>()..., TypeId {0}};
+            return RegisterComponentPackIndex(NGIN::Hashing::FNV1a64(reinterpret_cast<const char*>(ids), sizeof(ids)));
+        }();
+        return kIndex;
+    }
+
+    /// @brief Per-type component options. Specialize to change the defaults for a component type:
+    ///
+    /// @code
+    /// template<>
+    /// struct NGIN::ECS::ComponentTraits<Transform>
+    /// {
+    ///     static constexpr bool TrackChanges = false;
+    /// };
+    /// @endcode
+    template<typename T>
+    struct ComponentTraits
+    {
+        /// @brief Store added/changed ticks for this component. When false the chunk spends no tick storage on it
+        /// and `Added<T>` / `Changed<T>` query terms are rejected at compile time.
+        static constexpr bool TrackChanges = true;
+    };
+
     struct ComponentInfo
     {
         TypeId              id {0};
+        ComponentIndex      Index {kInvalidComponentIndex};
         NGIN::UIntSize      Size {0};
         NGIN::UIntSize      Align {1};
         bool                IsPOD {false};
         bool                IsEmpty {false};
         bool                IsBitwiseRelocatable {false};
+        bool                TrackChanges {true};
         CopyConstructFn     CopyConstruct {nullptr};
         MoveConstructFn     MoveConstruct {nullptr};
         RelocateConstructFn RelocateConstruct {nullptr};
@@ -103,7 +156,7 @@ namespace NGIN::ECS
     }// namespace detail
 
     template<typename T>
-    [[nodiscard]] inline ComponentInfo DescribeComponent() noexcept
+    [[nodiscard]] inline ComponentInfo DescribeComponent()
     {
         using Component = std::remove_cvref_t<T>;
         static_assert(std::is_destructible_v<Component>, "ECS components must be destructible.");
@@ -112,11 +165,13 @@ namespace NGIN::ECS
 
         ComponentInfo info {};
         info.id                   = GetTypeId<Component>();
+        info.Index                = GetComponentIndex<Component>();
         info.Size                 = sizeof(Component);
         info.Align                = alignof(Component);
         info.IsPOD                = std::is_trivially_copyable_v<Component> && std::is_trivially_destructible_v<Component>;
         info.IsEmpty              = std::is_empty_v<Component>;
         info.IsBitwiseRelocatable = NGIN::Meta::TypeTraits<Component>::IsBitwiseRelocatable();
+        info.TrackChanges         = ComponentTraits<Component>::TrackChanges;
 
         if constexpr (!std::is_empty_v<Component>)
         {
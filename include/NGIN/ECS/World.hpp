@@ -7,16 +7,40 @@
 #include <NGIN/Containers/HashMap.hpp>
 #include <NGIN/Containers/Vector.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 namespace NGIN::ECS
 {
+    class Commands;
+
+    struct WorldOptions
+    {
+        /// @brief Byte budget for chunks of archetypes that have no explicit override.
+        NGIN::UIntSize   ChunkBytes {kDefaultChunkBytes};
+        /// @brief High-water marks for the world's chunk block pool.
+        ChunkPoolOptions ChunkPool {};
+    };
+
     class NGIN_ECS_API World
     {
     public:
         World() = default;
+        explicit World(const WorldOptions& options)
+            : m_chunkPool(options.ChunkPool)
+        {
+            SetDefaultChunkBytes(options.ChunkBytes);
+        }
+
         World(const World&)            = delete;
         World& operator=(const World&) = delete;
         World(World&&)                 = delete;
@@ -31,47 +55,242 @@ namespace NGIN::ECS
             ++m_currentEpoch;
         }
 
+        [[nodiscard]] NGIN::UIntSize DefaultChunkBytes() const noexcept { return m_defaultChunkBytes; }
+
+        /// @brief Sets the chunk byte budget used by archetypes created after this call.
+        void SetDefaultChunkBytes(NGIN::UIntSize chunkBytes)
+        {
+            if (chunkBytes == 0)
+            {
+                throw std::invalid_argument("Chunk byte budget must be non-zero.");
+            }
+            m_defaultChunkBytes = chunkBytes;
+        }
+
+        /// @brief Pool that recycles chunk blocks freed by this world's archetypes.
+        [[nodiscard]] ChunkPool& GetChunkPool() noexcept { return m_chunkPool; }
+        [[nodiscard]] const ChunkPool& GetChunkPool() const noexcept { return m_chunkPool; }
+
+        /// @brief Overrides the chunk byte budget of the archetype for exactly {Cs...}, creating it if needed.
+        /// Chunks that already exist keep their capacity; only newly allocated chunks use the new budget.
+        template<typename... Cs>
+        void SetChunkBytes(NGIN::UIntSize chunkBytes)
+        {
+            (RegisterComponent<std::remove_cvref_t<Cs>>(), ...);
+            const auto archetypeIndex = GetOrCreateArchetypeIndex(BuildSignature<std::remove_cvref_t<Cs>...>());
+            m_archetypes[archetypeIndex]->SetChunkBytes(chunkBytes);
+        }
+
         [[nodiscard]] EntityId Spawn()
         {
-            NGIN::Containers::Vector<ComponentPayload> payloads;
-            return SpawnWithPayloads(payloads);
+            return SpawnReserved(NullEntityId);
         }
 
+        /// @brief Spawns an entity with @p components. The archetype of the pack and the column each argument goes to
+        /// are resolved on the first spawn of that pack in this world, so later spawns construct straight into the
+        /// chunk without allocating.
         template<typename... Cs>
         [[nodiscard]] EntityId Spawn(Cs&&... components)
         {
-            NGIN::Containers::Vector<ComponentPayload> payloads;
-            payloads.Reserve(sizeof...(Cs));
-            (payloads.EmplaceBack(CapturePayload(std::forward<Cs>(components))), ...);
-            return SpawnWithPayloads(payloads);
+            return SpawnReserved(NullEntityId, std::forward<Cs>(components)...);
+        }
+
+        /// @brief Spawns @p count entities of the pack {Cs...}; entity @p i takes its components from the
+        /// std::tuple<Cs...> returned by @p generator(i). Ids are allocated in one go and the archetype is grown once.
+        /// If a component constructor throws, entities spawned before it stay alive and the rest are released.
+        template<typename... Cs, typename Generator>
+            requires std::is_invocable_r_v<std::tuple<Cs...>, Generator&, NGIN::UIntSize>
+        [[nodiscard]] NGIN::Containers::Vector<EntityId> SpawnBatch(NGIN::UIntSize count, Generator&& generator)
+        {
+            static_assert(sizeof...(Cs) > 0, "SpawnBatch needs at least one component type.");
+            const auto& pack        = ResolveSpawnPack<Cs...>();
+            auto        entities    = CreateBatchIds(count);
+            NGIN::UIntSize placed   = 0;
+            static constexpr auto kPlacers = TuplePlacers<Cs...>(std::index_sequence_for<Cs...> {});
+
+            std::optional<std::tuple<Cs...>> current;
+            try
+            {
+                auto* archetype = m_archetypes[pack.ArchetypeIndex].Get();
+                archetype->EmplaceRows(
+                    count,
+                    [&](NGIN::UIntSize item) {
+                        current.emplace(generator(item));
+                        return entities[item];
+                    },
+                    [&](Chunk& chunk, NGIN::UIntSize, NGIN::UIntSize row, NGIN::UIntSize columnIndex, const ComponentInfo& info,
+                        NGIN::UIntSize) {
+                        if (!info.IsEmpty)
+                        {
+                            kPlacers[pack.ColumnSources[columnIndex]](chunk.ComponentPtr(columnIndex, row), &*current);
+                        }
+                        chunk.SetAddedTick(columnIndex, row, m_currentEpoch);
+                        chunk.SetChangedTick(columnIndex, row, 0);
+                    },
+                    [&](NGIN::UIntSize item, ArchetypeRowAddress address) {
+                        SetLocation(m_entities.SlotAt(GetEntityIndex(entities[item])), pack.ArchetypeIndex, address);
+                        placed = item + 1;
+                    });
+            } catch (...)
+            {
+                ReleaseUnplaced(entities, placed);
+                throw;
+            }
+            return entities;
+        }
+
+        /// @brief Spawns one entity per element of equally long @p columns, copying the components column by column:
+        /// trivially copyable components with one memcpy per chunk run. Throws std::invalid_argument when the spans
+        /// differ in length.
+        template<typename... Cs>
+        [[nodiscard]] NGIN::Containers::Vector<EntityId> SpawnBatch(std::span<const Cs>... columns)
+        {
+            static_assert(sizeof...(Cs) > 0, "SpawnBatch needs at least one component type.");
+            const NGIN::UIntSize sizes[] = {columns.size()...};
+            const auto           count   = sizes[0];
+            for (const auto size : sizes)
+            {
+                if (size != count)
+                {
+                    throw std::invalid_argument("SpawnBatch columns must have the same length.");
+                }
+            }
+
+            const auto& pack        = ResolveSpawnPack<Cs...>();
+            auto        entities    = CreateBatchIds(count);
+            NGIN::UIntSize placed   = 0;
+            const void* sources[]   = {static_cast<const void*>(columns.data())...};
+            static constexpr CopyComponentRunFn kCopiers[] = {&CopyComponentRun<Cs>...};
+
+            try
+            {
+                m_archetypes[pack.ArchetypeIndex]->AppendRows(
+                    std::span<const EntityId>(entities.data(), count),
+                    [&](Chunk& chunk, NGIN::UIntSize columnIndex, const ComponentInfo& info, NGIN::UIntSize firstRow,
+                        NGIN::UIntSize rowCount, NGIN::UIntSize firstItem) {
+                        if (!info.IsEmpty)
+                        {
+                            const auto source = pack.ColumnSources[columnIndex];
+                            kCopiers[source](chunk.ComponentPtr(columnIndex, firstRow), sources[source], firstItem, rowCount);
+                        }
+                        chunk.SetAddedTicks(columnIndex, firstRow, rowCount, m_currentEpoch);
+                        chunk.SetChangedTicks(columnIndex, firstRow, rowCount, 0);
+                    },
+                    [&](NGIN::UIntSize firstItem, NGIN::UIntSize chunkIndex, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount) {
+                        for (NGIN::UIntSize offset = 0; offset < rowCount; ++offset)
+                        {
+                            SetLocation(m_entities.SlotAt(GetEntityIndex(entities[firstItem + offset])),
+                                        pack.ArchetypeIndex,
+                                        ArchetypeRowAddress {chunkIndex, firstRow + offset});
+                        }
+                        placed = firstItem + rowCount;
+                    });
+            } catch (...)
+            {
+                ReleaseUnplaced(entities, placed);
+                throw;
+            }
+            return entities;
+        }
+
+        /// @brief Reserves an id for an entity that is spawned later (see Commands::Spawn). The id is not alive until
+        /// then. Lock-free and safe to call from several threads at once while the world is not being modified.
+        [[nodiscard]] EntityId ReserveEntity()
+        {
+            return m_entities.Reserve();
         }
 
         void Despawn(EntityId entityId)
         {
-            if (!IsAlive(entityId))
+            const auto* slot = m_entities.Find(entityId);
+            if (!slot)
             {
                 return;
             }
 
-            const auto entityIndex = GetEntityIndex(entityId);
-            auto&      slot        = m_slots[entityIndex];
-            auto       location    = slot.Location;
-            auto*      archetype   = m_archetypes[location.ArchetypeIndex].Get();
-            if (archetype)
+            if (slot->HasLocation())
             {
-                archetype->RemoveRow(location.ChunkIndex, location.RowIndex, [&](EntityId movedEntity,
-                                                                                 NGIN::UIntSize chunkIndex,
-                                                                                 NGIN::UIntSize rowIndex) {
-                    auto& movedSlot             = m_slots[GetEntityIndex(movedEntity)];
-                    movedSlot.Location.ChunkIndex = chunkIndex;
-                    movedSlot.Location.RowIndex   = rowIndex;
+                m_archetypes[slot->ArchetypeIndex]->RemoveRow(slot->ChunkIndex, slot->RowIndex, [&](EntityId movedEntity,
+                                                                                                   NGIN::UIntSize chunkIndex,
+                                                                                                   NGIN::UIntSize rowIndex) {
+                    SetRowLocation(m_entities.SlotAt(GetEntityIndex(movedEntity)), chunkIndex, rowIndex);
                 });
             }
 
             m_entities.Destroy(entityId);
-            slot.Generation = m_entities.GenerationAtIndex(entityIndex);
-            slot.Alive      = false;
-            slot.Location   = {};
+        }
+
+        /// @brief Despawns every live entity in @p entities; stale, null and repeated ids are ignored.
+        ///
+        /// Rows are grouped by archetype and chunk: each chunk is compacted once, with survivors from its tail
+        /// filling the holes, and chunks that lose every row are freed without moving any of them.
+        void DespawnBatch(std::span<const EntityId> entities)
+        {
+            GroupRowsByChunk(entities);
+            for (const auto entityId : entities)
+            {
+                m_entities.Destroy(entityId);
+            }
+
+            const auto relocate = [&](EntityId movedEntity, NGIN::UIntSize chunkIndex, NGIN::UIntSize rowIndex) {
+                SetRowLocation(m_entities.SlotAt(GetEntityIndex(movedEntity)), chunkIndex, rowIndex);
+            };
+            for (NGIN::UIntSize index = 0; index < m_batchGroups.Size(); ++index)
+            {
+                const auto& group     = m_batchGroups[index];
+                auto*       archetype = m_archetypes[group.ArchetypeIndex()].Get();
+                archetype->RemoveRows(group.ChunkIndex(), BatchRows(group), relocate);
+                // Chunk indices stay valid until every chunk of the archetype has been compacted.
+                if (IsLastGroupOfArchetype(index))
+                {
+                    archetype->ReleaseEmptyChunks(relocate);
+                }
+            }
+        }
+
+        /// @brief Despawns every entity @p query (a Query over this world) currently matches.
+        template<typename QueryType>
+        void DespawnMatching(QueryType& query)
+        {
+            DespawnBatch(CollectMatches(query));
+        }
+
+        /// @brief Adds a copy of @p value as component @p T to every entity @p query (a Query over this world) matches
+        /// that does not have @p T yet; returns how many entities gained it.
+        ///
+        /// Rows move one source chunk at a time: each run of rows is appended to the destination archetype in one go,
+        /// bitwise-relocatable columns are copied with one memcpy per contiguous run, and the source chunk is
+        /// compacted once afterwards. Chunks emptied by the move go back to the chunk pool.
+        template<typename T, typename QueryType>
+        NGIN::UIntSize AddToAll(QueryType& query, const T& value)
+        {
+            RegisterComponent<T>();
+            GroupRowsByChunk(CollectMatches(query));
+            return MigrateGroups(
+                [&](NGIN::UIntSize sourceIndex) {
+                    return m_archetypes[sourceIndex]->template Has<T>() ? kInvalidIndex : ResolveAddTransition<T>(sourceIndex);
+                },
+                [&](Chunk& chunk, NGIN::UIntSize columnIndex, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount) {
+                    if constexpr (!std::is_empty_v<T>)
+                    {
+                        std::uninitialized_fill_n(static_cast<T*>(chunk.ComponentPtr(columnIndex, firstRow)), rowCount, value);
+                    }
+                });
+        }
+
+        /// @brief Removes component @p T from every entity @p query (a Query over this world) matches; returns how
+        /// many entities lost it. Moves rows in bulk as AddToAll() does.
+        template<typename T, typename QueryType>
+        NGIN::UIntSize RemoveFromAll(QueryType& query)
+        {
+            GroupRowsByChunk(CollectMatches(query));
+            return MigrateGroups(
+                [&](NGIN::UIntSize sourceIndex) {
+                    return m_archetypes[sourceIndex]->template Has<T>() ? ResolveRemoveTransition<T>(sourceIndex) : kInvalidIndex;
+                },
+                [](Chunk&, NGIN::UIntSize, NGIN::UIntSize, NGIN::UIntSize) {
+                    throw std::logic_error("Removing a component cannot add a column.");
+                });
         }
 
         [[nodiscard]] bool IsAlive(EntityId entityId) const noexcept
@@ -86,46 +305,35 @@ namespace NGIN::ECS
 
         void Clear()
         {
+            m_structureVersion = NextStructureVersion();
             m_archetypes.Clear();
             m_archIndex.Clear();
+            m_spawnPacks.Clear();
             m_entities.Clear();
-            m_slots.Clear();
         }
 
         template<typename T>
-        [[nodiscard]] bool Has(EntityId entityId) const noexcept
+        [[nodiscard]] bool Has(EntityId entityId) const
         {
-            if (!IsAlive(entityId))
-            {
-                return false;
-            }
-
-            const auto& slot = m_slots[GetEntityIndex(entityId)];
-            if (!slot.Location.IsValid())
+            const auto* slot = m_entities.Find(entityId);
+            if (!slot || !slot->HasLocation())
             {
                 return false;
             }
-
-            const auto* archetype = m_archetypes[slot.Location.ArchetypeIndex].Get();
-            return archetype->HasComponent(GetTypeId<T>());
+            return m_archetypes[slot->ArchetypeIndex]->Has<T>();
         }
 
         template<typename T>
-        [[nodiscard]] const T* TryGet(EntityId entityId) const noexcept
+        [[nodiscard]] const T* TryGet(EntityId entityId) const
         {
-            if (!IsAlive(entityId))
+            const auto* slot = m_entities.Find(entityId);
+            if (!slot || !slot->HasLocation())
             {
                 return nullptr;
             }
 
-            const auto& slot = m_slots[GetEntityIndex(entityId)];
-            if (!slot.Location.IsValid())
-            {
-                return nullptr;
-            }
-
-            const auto* archetype = m_archetypes[slot.Location.ArchetypeIndex].Get();
-            const auto  column    = archetype->FindColumnIndex(GetTypeId<T>());
+            const auto* archetype = m_archetypes[slot->ArchetypeIndex].Get();
+            const auto  column    = archetype->FindColumn(GetComponentIndex<T>());
             if (column == kInvalidIndex)
             {
                 return nullptr;
@@ -137,26 +345,21 @@ namespace NGIN::ECS
                 return &instance;
             }
 
-            const auto* chunk = archetype->GetChunk(slot.Location.ChunkIndex);
-            return static_cast<const T*>(chunk->ComponentPtr(column, slot.Location.RowIndex));
+            const auto* chunk = archetype->GetChunk(slot->ChunkIndex);
+            return static_cast<const T*>(chunk->ComponentPtr(column, slot->RowIndex));
         }
 
         template<typename T>
-        [[nodiscard]] T* TryGetMut(EntityId entityId) noexcept
+        [[nodiscard]] T* TryGetMut(EntityId entityId)
         {
-            if (!IsAlive(entityId))
+            const auto* slot = m_entities.Find(entityId);
+            if (!slot || !slot->HasLocation())
             {
                 return nullptr;
             }
 
-            const auto& slot = m_slots[GetEntityIndex(entityId)];
-            if (!slot.Location.IsValid())
-            {
-                return nullptr;
-            }
-
-            auto* archetype = m_archetypes[slot.Location.ArchetypeIndex].Get();
-            const auto column = archetype->FindColumnIndex(GetTypeId<T>());
+            auto* archetype = m_archetypes[slot->ArchetypeIndex].Get();
+            const auto column = archetype->FindColumn(GetComponentIndex<T>());
             if (column == kInvalidIndex)
             {
                 return nullptr;
@@ -168,8 +371,8 @@ namespace NGIN::ECS
                 return &instance;
             }
 
-            auto* chunk = archetype->GetChunk(slot.Location.ChunkIndex);
-            return static_cast<T*>(chunk->ComponentPtr(column, slot.Location.RowIndex));
+            auto* chunk = archetype->GetChunk(slot->ChunkIndex);
+            return static_cast<T*>(chunk->ComponentPtr(column, slot->RowIndex));
         }
 
         template<typename T>
@@ -201,9 +404,10 @@ namespace NGIN::ECS
                 throw std::invalid_argument("Component already exists on entity.");
             }
 
+            const auto sourceIndex = m_entities.SlotAt(GetEntityIndex(entityId)).ArchetypeIndex;
             NGIN::Containers::Vector<ComponentPayload> payloads;
             payloads.EmplaceBack(CaptureTypedPayload<T>(std::forward<U>(value)));
-            MoveEntityToSignature(entityId, BuildSignatureWithAdded<T>(entityId), payloads);
+            MoveEntityToArchetype(entityId, ResolveAddTransition<T>(sourceIndex), payloads);
         }
 
         template<typename T>
@@ -215,7 +419,8 @@ namespace NGIN::ECS
                 return false;
             }
 
-            MoveEntityToSignature(entityId, BuildSignatureWithRemoved<T>(entityId), {});
+            const auto sourceIndex = m_entities.SlotAt(GetEntityIndex(entityId)).ArchetypeIndex;
+            MoveEntityToArchetype(entityId, ResolveRemoveTransition<T>(sourceIndex), {});
             return true;
         }
 
@@ -229,10 +434,11 @@ namespace NGIN::ECS
                 throw std::out_of_range("Component is not present on entity.");
             }
 
-            auto*       archetype = m_archetypes[m_slots[GetEntityIndex(entityId)].Location.ArchetypeIndex].Get();
-            const auto  column    = archetype->ColumnIndexOf(GetTypeId<T>());
-            auto*       chunk     = archetype->GetChunk(m_slots[GetEntityIndex(entityId)].Location.ChunkIndex);
-            const auto  row       = m_slots[GetEntityIndex(entityId)].Location.RowIndex;
+            const auto& slot      = m_entities.SlotAt(GetEntityIndex(entityId));
+            auto*       archetype = m_archetypes[slot.ArchetypeIndex].Get();
+            const auto  column    = archetype->RequireColumn(GetComponentIndex<T>());
+            auto*       chunk     = archetype->GetChunk(slot.ChunkIndex);
+            const auto  row       = slot.RowIndex;
             const auto& info      = archetype->ComponentAt(column);
 
             if (!info.IsEmpty)
@@ -249,10 +455,11 @@ namespace NGIN::ECS
         void MarkChanged(EntityId entityId)
         {
             ValidateAlive(entityId);
-            auto* archetype = m_archetypes[m_slots[GetEntityIndex(entityId)].Location.ArchetypeIndex].Get();
-            const auto column = archetype->ColumnIndexOf(GetTypeId<T>());
-            auto* chunk = archetype->GetChunk(m_slots[GetEntityIndex(entityId)].Location.ChunkIndex);
-            chunk->SetChangedTick(column, m_slots[GetEntityIndex(entityId)].Location.RowIndex, m_currentEpoch);
+            const auto& slot = m_entities.SlotAt(GetEntityIndex(entityId));
+            auto* archetype = m_archetypes[slot.ArchetypeIndex].Get();
+            const auto column = archetype->RequireColumn(GetComponentIndex<T>());
+            auto* chunk = archetype->GetChunk(slot.ChunkIndex);
+            chunk->SetChangedTick(column, slot.RowIndex, m_currentEpoch);
         }
 
         [[nodiscard]] const NGIN::Containers::Vector<NGIN::Memory::Scoped<Archetype>>& Archetypes() const noexcept
@@ -260,6 +467,12 @@ namespace NGIN::ECS
             return m_archetypes;
         }
 
+        /// @brief Replaced whenever existing archetypes are discarded; archetypes are otherwise only ever appended.
+        ///
+        /// Values come from a process-wide counter, so no two worlds (including one constructed at the address of a
+        /// destroyed one) ever report the same version.
+        [[nodiscard]] NGIN::UInt64 StructureVersion() const noexcept { return m_structureVersion; }
+
         template<typename... Cs>
         [[nodiscard]] NGIN::UIntSize DebugGetChunkCount() const
         {
@@ -281,29 +494,280 @@ namespace NGIN::ECS
             {
                 return 0;
             }
-            return m_archetypes[*index]->ComputeCapacityForChunkBytes(kDefaultChunkBytes);
+            return m_archetypes[*index]->ChunkCapacity();
         }
 
     private:
-        struct EntityLocation
+        friend class Commands;
+
+        /// @brief Draws the next value of the process-wide structure version counter.
+        [[nodiscard]] static NGIN::UInt64 NextStructureVersion() noexcept;
+
+        /// @brief Rows of one chunk touched by a batch operation; Key is (archetype index << 32) | chunk index and
+        /// [Offset, Offset + Count) the group's ascending rows in m_batchRows.
+        struct BatchGroup
         {
-            NGIN::UIntSize ArchetypeIndex {kInvalidIndex};
-            NGIN::UIntSize ChunkIndex {kInvalidIndex};
-            NGIN::UIntSize RowIndex {kInvalidIndex};
+            NGIN::UInt64   Key;
+            NGIN::UIntSize Offset;
+            NGIN::UIntSize Count;
 
-            [[nodiscard]] bool IsValid() const noexcept
-            {
-                return ArchetypeIndex != kInvalidIndex && ChunkIndex != kInvalidIndex && RowIndex != kInvalidIndex;
-            }
+            [[nodiscard]] NGIN::UIntSize ArchetypeIndex() const noexcept { return static_cast<NGIN::UIntSize>(Key >> 32); }
+            [[nodiscard]] NGIN::UIntSize ChunkIndex() const noexcept { return static_cast<NGIN::UIntSize>(Key & 0xFFFFFFFFu); }
         };
 
-        struct EntitySlot
+        struct BatchRow
         {
-            NGIN::UInt16   Generation {0};
-            bool           Alive {false};
-            EntityLocation Location {};
+            NGIN::UInt32 Group;
+            NGIN::UInt32 RowIndex;
         };
 
+        /// @brief Entities @p query currently matches, gathered into reusable scratch.
+        template<typename QueryType>
+        [[nodiscard]] std::span<const EntityId> CollectMatches(QueryType& query)
+        {
+            m_batchEntities.Clear();
+            query.ForEach([&](const auto& row) { m_batchEntities.EmplaceBack(row.Entity()); });
+            return std::span<const EntityId>(m_batchEntities.data(), m_batchEntities.Size());
+        }
+
+        /// @brief Buckets the rows of the live entities in @p entities by chunk into m_batchGroups (ordered by
+        /// archetype, then chunk) and m_batchRows (ascending within a group). Repeated ids are counted once.
+        ///
+        /// A counting pass over the chunk groups replaces a full sort; only the groups and the rows inside each
+        /// group get sorted, which keeps the cost to a handful of short runs.
+        void GroupRowsByChunk(std::span<const EntityId> entities)
+        {
+            m_batchGroupOf.Clear();
+            m_batchGroups.Clear();
+            m_batchVictims.Clear();
+            m_batchRows.Clear();
+            m_batchVictims.Reserve(entities.size());
+
+            NGIN::UIntSize group = 0;
+            for (const auto entityId : entities)
+            {
+                const auto* slot = m_entities.Find(entityId);
+                if (!slot || !slot->HasLocation())
+                {
+                    continue;
+                }
+                const auto key = (static_cast<NGIN::UInt64>(slot->ArchetypeIndex) << 32) | slot->ChunkIndex;
+                if (m_batchGroups.Size() == 0 || m_batchGroups[group].Key != key)
+                {
+                    if (const auto* existing = m_batchGroupOf.GetPtr(key))
+                    {
+                        group = *existing;
+                    }
+                    else
+                    {
+                        group = m_batchGroups.Size();
+                        m_batchGroupOf.Insert(key, group);
+                        m_batchGroups.EmplaceBack(BatchGroup {key, 0, 0});
+                    }
+                }
+                ++m_batchGroups[group].Count;
+                m_batchVictims.EmplaceBack(BatchRow {static_cast<NGIN::UInt32>(group), slot->RowIndex});
+            }
+
+            NGIN::UIntSize offset = 0;
+            for (auto& entry : m_batchGroups)
+            {
+                entry.Offset = offset;
+                offset += entry.Count;
+                entry.Count = 0;
+            }
+            m_batchRows.Reserve(m_batchVictims.Size());
+            for (NGIN::UIntSize index = 0; index < m_batchVictims.Size(); ++index)
+            {
+                m_batchRows.EmplaceBack(0);
+            }
+            for (const auto& victim : m_batchVictims)
+            {
+                auto& entry                               = m_batchGroups[victim.Group];
+                m_batchRows[entry.Offset + entry.Count++] = victim.RowIndex;
+            }
+
+            std::sort(m_batchGroups.begin(), m_batchGroups.end(), [](const BatchGroup& lhs, const BatchGroup& rhs) {
+                return lhs.Key < rhs.Key;
+            });
+            for (auto& entry : m_batchGroups)
+            {
+                auto* first = m_batchRows.data() + entry.Offset;
+                std::sort(first, first + entry.Count);
+                // A repeated id shows up as a repeated row.
+                entry.Count = static_cast<NGIN::UIntSize>(std::unique(first, first + entry.Count) - first);
+            }
+        }
+
+        [[nodiscard]] std::span<const NGIN::UIntSize> BatchRows(const BatchGroup& group) const noexcept
+        {
+            return std::span<const NGIN::UIntSize>(m_batchRows.data() + group.Offset, group.Count);
+        }
+
+        [[nodiscard]] bool IsLastGroupOfArchetype(NGIN::UIntSize index) const noexcept
+        {
+            return index + 1 == m_batchGroups.Size()
+                   || m_batchGroups[index + 1].ArchetypeIndex() != m_batchGroups[index].ArchetypeIndex();
+        }
+
+        /// @brief Moves the rows grouped by GroupRowsByChunk() to @p destinationFor(sourceArchetypeIndex), skipping
+        /// archetypes it maps to kInvalidIndex. @p constructAdded(chunk, column, firstRow, rowCount) constructs the
+        /// column only the destination has, destroying what it built if it throws. Returns the number of moved rows.
+        template<typename DestinationFn, typename ConstructAddedFn>
+        NGIN::UIntSize MigrateGroups(DestinationFn&& destinationFor, ConstructAddedFn&& constructAdded)
+        {
+            const auto relocate = [&](EntityId movedEntity, NGIN::UIntSize chunkIndex, NGIN::UIntSize rowIndex) {
+                SetRowLocation(m_entities.SlotAt(GetEntityIndex(movedEntity)), chunkIndex, rowIndex);
+            };
+
+            NGIN::UIntSize moved            = 0;
+            NGIN::UIntSize destinationIndex = kInvalidIndex;
+            for (NGIN::UIntSize index = 0; index < m_batchGroups.Size(); ++index)
+            {
+                const auto& group       = m_batchGroups[index];
+                const auto  sourceIndex = group.ArchetypeIndex();
+                if (index == 0 || m_batchGroups[index - 1].ArchetypeIndex() != sourceIndex)
+                {
+                    destinationIndex = destinationFor(sourceIndex);
+                }
+                if (destinationIndex == kInvalidIndex)
+                {
+                    continue;
+                }
+
+                auto*      source      = m_archetypes[sourceIndex].Get();
+                auto*      destination = m_archetypes[destinationIndex].Get();
+                auto*      sourceChunk = source->GetChunk(group.ChunkIndex());
+                const auto rows        = BatchRows(group);
+
+                m_batchEntities.Clear();
+                for (const auto row : rows)
+                {
+                    m_batchEntities.EmplaceBack(sourceChunk->EntityAt(row));
+                }
+
+                NGIN::UIntSize placed = 0;
+                try
+                {
+                    destination->AppendRows(
+                        std::span<const EntityId>(m_batchEntities.data(), m_batchEntities.Size()),
+                        [&](Chunk& chunk, NGIN::UIntSize columnIndex, const ComponentInfo& info, NGIN::UIntSize firstRow,
+                            NGIN::UIntSize rowCount, NGIN::UIntSize firstItem) {
+                            const auto sourceColumn = source->FindColumn(info.Index);
+                            if (sourceColumn == kInvalidIndex)
+                            {
+                                constructAdded(chunk, columnIndex, firstRow, rowCount);
+                                chunk.SetAddedTicks(columnIndex, firstRow, rowCount, m_currentEpoch);
+                                chunk.SetChangedTicks(columnIndex, firstRow, rowCount, 0);
+                                return;
+                            }
+                            MoveColumnRun(*sourceChunk, sourceColumn, rows.subspan(firstItem, rowCount), chunk, columnIndex, firstRow);
+                        },
+                        [&](NGIN::UIntSize firstItem, NGIN::UIntSize chunkIndex, NGIN::UIntSize firstRow, NGIN::UIntSize rowCount) {
+                            for (NGIN::UIntSize offset = 0; offset < rowCount; ++offset)
+                            {
+                                SetLocation(m_entities.SlotAt(GetEntityIndex(m_batchEntities[firstItem + offset])),
+                                            destinationIndex,
+                                            ArchetypeRowAddress {chunkIndex, firstRow + offset});
+                            }
+                            placed = firstItem + rowCount;
+                        });
+                } catch (...)
+                {
+                    // Rows that already made it across leave their moved-from source rows behind.
+                    source->RemoveRows(group.ChunkIndex(), rows.first(placed), relocate);
+                    source->ReleaseEmptyChunks(relocate);
+                    throw;
+                }
+
+                source->RemoveRows(group.ChunkIndex(), rows, relocate);
+                moved += rows.size();
+                if (IsLastGroupOfArchetype(index))
+                {
+                    source->ReleaseEmptyChunks(relocate);
+                }
+            }
+            return moved;
+        }
+
+        /// @brief Move-constructs column @p sourceColumn of @p sourceRows (ascending) into @p destination starting at
+        /// @p firstRow, with one memcpy per contiguous run for bitwise-relocatable components, and carries the ticks
+        /// over. Destroys what it built if a constructor throws.
+        static void MoveColumnRun(Chunk& source,
+                                  NGIN::UIntSize sourceColumn,
+                                  std::span<const NGIN::UIntSize> sourceRows,
+                                  Chunk& destination,
+                                  NGIN::UIntSize destinationColumn,
+                                  NGIN::UIntSize firstRow)
+        {
+            const auto&    info        = destination.ColumnInfo(destinationColumn);
+            NGIN::UIntSize constructed = 0;
+            try
+            {
+                while (constructed < sourceRows.size())
+                {
+                    const auto sourceRow = sourceRows[constructed];
+                    auto       run       = NGIN::UIntSize {1};
+                    while (constructed + run < sourceRows.size() && sourceRows[constructed + run] == sourceRow + run)
+                    {
+                        ++run;
+                    }
+
+                    const auto destinationRow = firstRow + constructed;
+                    destination.CopyTicks(destinationColumn, destinationRow, source, sourceColumn, sourceRow, run);
+                    if (info.IsEmpty)
+                    {
+                        constructed += run;
+                    }
+                    else if (info.IsBitwiseRelocatable)
+                    {
+                        std::memcpy(destination.ComponentPtr(destinationColumn, destinationRow),
+                                    source.ComponentPtr(sourceColumn, sourceRow),
+                                    run * info.Size);
+                        constructed += run;
+                    }
+                    else
+                    {
+                        for (NGIN::UIntSize offset = 0; offset < run; ++offset, ++constructed)
+                        {
+                            auto* target = destination.ComponentPtr(destinationColumn, destinationRow + offset);
+                            auto* value  = source.ComponentPtr(sourceColumn, sourceRow + offset);
+                            if (info.MoveConstruct)
+                            {
+                                info.MoveConstruct(target, value);
+                            }
+                            else
+                            {
+                                info.CopyConstruct(target, value);
+                            }
+                        }
+                    }
+                }
+            } catch (...)
+            {
+                for (NGIN::UIntSize row = firstRow; row < firstRow + constructed; ++row)
+                {
+                    if (info.Destroy)
+                    {
+                        info.Destroy(destination.ComponentPtr(destinationColumn, row));
+                    }
+                }
+                throw;
+            }
+        }
+
+        static void SetLocation(EntitySlot& slot, NGIN::UIntSize archetypeIndex, ArchetypeRowAddress address) noexcept
+        {
+            slot.ArchetypeIndex = static_cast<NGIN::UInt32>(archetypeIndex);
+            SetRowLocation(slot, address.ChunkIndex, address.RowIndex);
+        }
+
+        static void SetRowLocation(EntitySlot& slot, NGIN::UIntSize chunkIndex, NGIN::UIntSize rowIndex) noexcept
+        {
+            slot.ChunkIndex = static_cast<NGIN::UInt32>(chunkIndex);
+            slot.RowIndex   = static_cast<NGIN::UInt32>(rowIndex);
+        }
+
         template<typename T>
         const ComponentInfo& RegisterComponent()
         {
@@ -357,41 +821,165 @@ namespace NGIN::ECS
             return ArchetypeSignature::FromUnordered(std::move(types));
         }
 
-        [[nodiscard]] EntityId SpawnWithPayloads(const NGIN::Containers::Vector<ComponentPayload>& payloads)
+        /// @brief Turns @p reserved into a live id, or creates a new one when it is null.
+        [[nodiscard]] EntityId AcquireEntity(EntityId reserved)
+        {
+            if (IsNull(reserved))
+            {
+                return m_entities.Create();
+            }
+            m_entities.Commit(reserved);
+            return reserved;
+        }
+
+        /// @brief Archetype of a spawned component pack and, per archetype column, the pack argument constructed
+        /// into it.
+        struct SpawnPack
         {
-            const auto entityId = m_entities.Create();
-            EnsureEntitySlot(entityId);
+            NGIN::UIntSize                         ArchetypeIndex {kInvalidIndex};
+            NGIN::Containers::Vector<NGIN::UInt32> ColumnSources;
+        };
 
-            const auto archetypeIndex = GetOrCreateArchetypeIndex(BuildSignatureFromPayloads(payloads));
-            const auto rowAddress     = InsertEntityIntoArchetype(entityId, archetypeIndex, payloads);
+        using PlaceComponentFn = void (*)(void* destination, void* source);
 
-            auto& slot              = m_slots[GetEntityIndex(entityId)];
-            slot.Generation         = GetEntityGeneration(entityId);
-            slot.Alive              = true;
-            slot.Location.ArchetypeIndex = archetypeIndex;
-            slot.Location.ChunkIndex     = rowAddress.ChunkIndex;
-            slot.Location.RowIndex       = rowAddress.RowIndex;
-            return entityId;
+        /// @brief Constructs the component forwarded as @p C from the argument at @p source.
+        template<typename C>
+        static void PlaceComponent(void* destination, void* source)
+        {
+            using Component = std::remove_cvref_t<C>;
+            ::new (destination) Component(std::forward<C>(*static_cast<std::remove_reference_t<C>*>(source)));
         }
 
-        [[nodiscard]] ArchetypeSignature BuildSignatureFromPayloads(const NGIN::Containers::Vector<ComponentPayload>& payloads)
+        using CopyComponentRunFn = void (*)(void* destination, const void* source, NGIN::UIntSize first, NGIN::UIntSize count);
+
+        /// @brief Move-constructs element @p I of the std::tuple<Cs...> at @p tuple.
+        template<NGIN::UIntSize I, typename... Cs>
+        static void PlaceTupleElement(void* destination, void* tuple)
         {
-            NGIN::Containers::Vector<TypeId> types;
-            types.Reserve(payloads.Size());
-            for (NGIN::UIntSize index = 0; index < payloads.Size(); ++index)
+            using Component = std::tuple_element_t<I, std::tuple<Cs...>>;
+            ::new (destination) Component(std::move(std::get<I>(*static_cast<std::tuple<Cs...>*>(tuple))));
+        }
+
+        /// @brief PlaceTupleElement() for every element of std::tuple<Cs...>, indexed like SpawnPack::ColumnSources.
+        template<typename... Cs, NGIN::UIntSize... Is>
+        static constexpr std::array<PlaceComponentFn, sizeof...(Cs)> TuplePlacers(std::index_sequence<Is...>) noexcept
+        {
+            return {&PlaceTupleElement<Is, Cs...>...};
+        }
+
+        /// @brief Copy-constructs @p count components from source[first...] into a contiguous chunk run.
+        template<typename C>
+        static void CopyComponentRun(void* destination, const void* source, NGIN::UIntSize first, NGIN::UIntSize count)
+        {
+            const auto* from = static_cast<const C*>(source) + first;
+            if constexpr (std::is_trivially_copyable_v<C>)
             {
-                types.EmplaceBack(payloads[index].id);
+                std::memcpy(destination, from, count * sizeof(C));
+            }
+            else
+            {
+                std::uninitialized_copy_n(from, count, static_cast<C*>(destination));
             }
-            return ArchetypeSignature::FromUnordered(std::move(types));
         }
 
-        void EnsureEntitySlot(EntityId entityId)
+        /// @brief Allocates @p count live ids for a batch spawn.
+        [[nodiscard]] NGIN::Containers::Vector<EntityId> CreateBatchIds(NGIN::UIntSize count)
         {
-            const auto entityIndex = GetEntityIndex(entityId);
-            while (m_slots.Size() <= entityIndex)
+            NGIN::Containers::Vector<EntityId> entities;
+            entities.Reserve(count);
+            for (NGIN::UIntSize item = 0; item < count; ++item)
             {
-                m_slots.EmplaceBack();
+                entities.EmplaceBack(NullEntityId);
             }
+            m_entities.CreateBatch(std::span<EntityId>(entities.data(), count));
+            return entities;
+        }
+
+        /// @brief Releases the ids of a failed batch spawn from @p placed onwards; earlier ones have rows.
+        void ReleaseUnplaced(const NGIN::Containers::Vector<EntityId>& entities, NGIN::UIntSize placed)
+        {
+            for (NGIN::UIntSize item = placed; item < entities.Size(); ++item)
+            {
+                m_entities.Destroy(entities[item]);
+            }
+        }
+
+        /// @brief Cached SpawnPack of {Cs...} in this world, resolved on first use.
+        template<typename... Cs>
+        [[nodiscard]] const SpawnPack& ResolveSpawnPack()
+        {
+            const auto packIndex = GetComponentPackIndex<Cs...>();
+            while (m_spawnPacks.Size() <= packIndex)
+            {
+                m_spawnPacks.EmplaceBack();
+            }
+
+            auto& pack = m_spawnPacks[packIndex];
+            if (pack.ArchetypeIndex != kInvalidIndex)
+            {
+                return pack;
+            }
+
+            const auto       archetypeIndex = ResolveArchetype<Cs...>();
+            const auto&      archetype      = *m_archetypes[archetypeIndex];
+            const ComponentIndex indices[]  = {GetComponentIndex<Cs>()..., kInvalidComponentIndex};
+
+            pack.ColumnSources.Clear();
+            pack.ColumnSources.Reserve(archetype.ComponentCount());
+            for (NGIN::UIntSize column = 0; column < archetype.ComponentCount(); ++column)
+            {
+                pack.ColumnSources.EmplaceBack(0);
+            }
+            // Walk backwards so the first argument of a repeated type wins, as with payload lookup.
+            for (NGIN::UIntSize source = sizeof...(Cs); source-- > 0;)
+            {
+                pack.ColumnSources[archetype.RequireColumn(indices[source])] = static_cast<NGIN::UInt32>(source);
+            }
+            pack.ArchetypeIndex = archetypeIndex;
+            return pack;
+        }
+
+        /// @brief Spawns the entity reserved as @p reserved (a new id when null).
+        template<typename... Cs>
+        EntityId SpawnReserved(EntityId reserved, Cs&&... components)
+        {
+            const auto& pack = ResolveSpawnPack<std::remove_cvref_t<Cs>...>();
+
+            void* sources[] = {const_cast<void*>(static_cast<const void*>(std::addressof(components)))..., nullptr};
+            static constexpr PlaceComponentFn kPlacers[] = {&PlaceComponent<Cs>..., nullptr};
+
+            const auto          entityId = AcquireEntity(reserved);
+            ArchetypeRowAddress rowAddress;
+            try
+            {
+                rowAddress = m_archetypes[pack.ArchetypeIndex]->EmplaceRow(entityId,
+                                                                           [&](Chunk& chunk,
+                                                                               NGIN::UIntSize,
+                                                                               NGIN::UIntSize row,
+                                                                               NGIN::UIntSize columnIndex,
+                                                                               const ComponentInfo& info) {
+                    if (!info.IsEmpty)
+                    {
+                        const auto source = pack.ColumnSources[columnIndex];
+                        kPlacers[source](chunk.ComponentPtr(columnIndex, row), sources[source]);
+                    }
+                    chunk.SetAddedTick(columnIndex, row, m_currentEpoch);
+                    chunk.SetChangedTick(columnIndex, row, 0);
+                });
+            } catch (...)
+            {
+                // The row was rolled back; don't leave a live id without a location behind.
+                m_entities.Destroy(entityId);
+                throw;
+            }
+
+            SetLocation(m_entities.SlotAt(GetEntityIndex(entityId)), pack.ArchetypeIndex, rowAddress);
+            return entityId;
+        }
+
+        void ReleaseReservedEntity(EntityId reserved)
+        {
+            m_entities.Cancel(reserved);
         }
 
         void ValidateAlive(EntityId entityId) const
@@ -417,7 +1005,10 @@ namespace NGIN::ECS
             }
 
             const auto archetypeIndex = m_archetypes.Size();
-            m_archetypes.EmplaceBack(NGIN::Memory::MakeScoped<Archetype>(signature, std::move(components)));
+            m_archetypes.EmplaceBack(NGIN::Memory::MakeScoped<Archetype>(signature,
+                                                                          std::move(components),
+                                                                          m_defaultChunkBytes,
+                                                                          &m_chunkPool));
             m_archIndex.Insert(signature, archetypeIndex);
             return archetypeIndex;
         }
@@ -459,48 +1050,79 @@ namespace NGIN::ECS
             }
         }
 
-        [[nodiscard]] ArchetypeRowAddress InsertEntityIntoArchetype(EntityId entityId,
-                                                                    NGIN::UIntSize archetypeIndex,
-                                                                    const NGIN::Containers::Vector<ComponentPayload>& payloads)
+        /// @brief Archetype for exactly {Cs...}, registering the component types on first use.
+        template<typename... Cs>
+        [[nodiscard]] NGIN::UIntSize ResolveArchetype()
         {
-            auto* archetype = m_archetypes[archetypeIndex].Get();
-            return archetype->EmplaceRow(entityId,
-                                         [&](Chunk& chunk,
-                                             NGIN::UIntSize,
-                                             NGIN::UIntSize row,
-                                             NGIN::UIntSize columnIndex,
-                                             const ComponentInfo& info) {
-                const auto* payload = FindPayload(payloads, info.id);
-                if (info.IsEmpty)
-                {
-                    chunk.SetAddedTick(columnIndex, row, m_currentEpoch);
-                    chunk.SetChangedTick(columnIndex, row, 0);
-                    return;
-                }
-                if (!payload)
-                {
-                    throw std::invalid_argument("Missing payload for archetype column.");
-                }
-                ConstructFromPayload(info, chunk.ComponentPtr(columnIndex, row), *payload);
-                chunk.SetAddedTick(columnIndex, row, m_currentEpoch);
-                chunk.SetChangedTick(columnIndex, row, 0);
-            });
+            (RegisterComponent<Cs>(), ...);
+            return GetOrCreateArchetypeIndex(BuildSignature<Cs...>());
+        }
+
+        /// @brief Spawns @p count entities of {Cs...}, moving the components of entity @p item out of the tuple
+        /// returned by @p source(item). @p reserved(item) names a reserved id to spawn under, or null for a new one.
+        template<typename... Cs, typename Source, typename Reserved>
+        void SpawnRows(NGIN::UIntSize count, Source&& source, Reserved&& reserved)
+        {
+            const auto& pack      = ResolveSpawnPack<Cs...>();
+            auto*       archetype = m_archetypes[pack.ArchetypeIndex].Get();
+            EntityId    unplaced  = NullEntityId; ///< Acquired id whose row is still being built.
+            static constexpr auto kPlacers = TuplePlacers<Cs...>(std::index_sequence_for<Cs...> {});
+            try
+            {
+                archetype->EmplaceRows(
+                    count,
+                    [&](NGIN::UIntSize item) { return unplaced = AcquireEntity(reserved(item)); },
+                    [&](Chunk& chunk, NGIN::UIntSize, NGIN::UIntSize row, NGIN::UIntSize columnIndex,
+                        const ComponentInfo& info, NGIN::UIntSize item) {
+                        if (!info.IsEmpty)
+                        {
+                            kPlacers[pack.ColumnSources[columnIndex]](chunk.ComponentPtr(columnIndex, row), &source(item));
+                        }
+                        chunk.SetAddedTick(columnIndex, row, m_currentEpoch);
+                        chunk.SetChangedTick(columnIndex, row, 0);
+                    },
+                    [&](NGIN::UIntSize, ArchetypeRowAddress address) {
+                        SetLocation(m_entities.SlotAt(GetEntityIndex(unplaced)), pack.ArchetypeIndex, address);
+                        unplaced = NullEntityId;
+                    });
+            } catch (...)
+            {
+                m_entities.Destroy(unplaced);
+                throw;
+            }
         }
 
+        /// @brief Follows (or creates and caches) the add edge for @p T out of @p sourceIndex.
         template<typename T>
-        [[nodiscard]] ArchetypeSignature BuildSignatureWithAdded(EntityId entityId)
+        [[nodiscard]] NGIN::UIntSize ResolveAddTransition(NGIN::UIntSize sourceIndex)
         {
+            const auto typeId = GetTypeId<T>();
+            const auto cached = m_archetypes[sourceIndex]->FindAddEdge(typeId);
+            if (cached != kInvalidIndex)
+            {
+                return cached;
+            }
+
             RegisterComponent<T>();
-            auto types = m_archetypes[m_slots[GetEntityIndex(entityId)].Location.ArchetypeIndex]->Signature().Types;
-            types.EmplaceBack(GetTypeId<T>());
-            return ArchetypeSignature::FromUnordered(std::move(types));
+            auto types = m_archetypes[sourceIndex]->Signature().Types;
+            types.EmplaceBack(typeId);
+            const auto destinationIndex = GetOrCreateArchetypeIndex(ArchetypeSignature::FromUnordered(std::move(types)));
+            LinkTransition(sourceIndex, destinationIndex, typeId);
+            return destinationIndex;
         }
 
+        /// @brief Follows (or creates and caches) the remove edge for @p T out of @p sourceIndex.
         template<typename T>
-        [[nodiscard]] ArchetypeSignature BuildSignatureWithRemoved(EntityId entityId)
+        [[nodiscard]] NGIN::UIntSize ResolveRemoveTransition(NGIN::UIntSize sourceIndex)
         {
-            auto types = m_archetypes[m_slots[GetEntityIndex(entityId)].Location.ArchetypeIndex]->Signature().Types;
             const auto typeId = GetTypeId<T>();
+            const auto cached = m_archetypes[sourceIndex]->FindRemoveEdge(typeId);
+            if (cached != kInvalidIndex)
+            {
+                return cached;
+            }
+
+            const auto& types = m_archetypes[sourceIndex]->Signature().Types;
             NGIN::Containers::Vector<TypeId> filtered;
             filtered.Reserve(types.Size());
             for (NGIN::UIntSize index = 0; index < types.Size(); ++index)
@@ -510,16 +1132,24 @@ namespace NGIN::ECS
                     filtered.EmplaceBack(types[index]);
                 }
             }
-            return ArchetypeSignature::FromUnordered(std::move(filtered));
+            const auto destinationIndex = GetOrCreateArchetypeIndex(ArchetypeSignature::FromUnordered(std::move(filtered)));
+            LinkTransition(destinationIndex, sourceIndex, typeId);
+            return destinationIndex;
         }
 
-        void MoveEntityToSignature(EntityId entityId,
-                                   const ArchetypeSignature& destinationSignature,
+        /// @brief Records that @p withIndex is @p withoutIndex plus @p typeId, in both directions.
+        void LinkTransition(NGIN::UIntSize withoutIndex, NGIN::UIntSize withIndex, TypeId typeId)
+        {
+            m_archetypes[withoutIndex]->SetAddEdge(typeId, withIndex);
+            m_archetypes[withIndex]->SetRemoveEdge(typeId, withoutIndex);
+        }
+
+        void MoveEntityToArchetype(EntityId entityId,
+                                   NGIN::UIntSize destinationIndex,
                                    const NGIN::Containers::Vector<ComponentPayload>& payloads)
         {
             const auto entityIndex        = GetEntityIndex(entityId);
-            const auto sourceLocation     = m_slots[entityIndex].Location;
-            const auto destinationIndex   = GetOrCreateArchetypeIndex(destinationSignature);
+            const auto sourceLocation     = m_entities.SlotAt(entityIndex);
             auto*      sourceArchetype    = m_archetypes[sourceLocation.ArchetypeIndex].Get();
             auto*      destinationArchetype = m_archetypes[destinationIndex].Get();
             auto*      sourceChunk        = sourceArchetype->GetChunk(sourceLocation.ChunkIndex);
@@ -531,7 +1161,7 @@ namespace NGIN::ECS
                     NGIN::UIntSize destinationRow,
                     NGIN::UIntSize destinationColumn,
                     const ComponentInfo& destinationInfo) {
-                    const auto sourceColumn = sourceArchetype->FindColumnIndex(destinationInfo.id);
+                    const auto sourceColumn = sourceArchetype->FindColumn(destinationInfo.Index);
                     if (sourceColumn != kInvalidIndex)
                     {
                         if (!destinationInfo.IsEmpty)
@@ -574,30 +1204,37 @@ namespace NGIN::ECS
                 }
             );
 
-            m_slots[entityIndex].Location.ArchetypeIndex = destinationIndex;
-            m_slots[entityIndex].Location.ChunkIndex     = destinationAddress.ChunkIndex;
-            m_slots[entityIndex].Location.RowIndex       = destinationAddress.RowIndex;
+            SetLocation(m_entities.SlotAt(entityIndex), destinationIndex, destinationAddress);
 
             sourceArchetype->RemoveRow(sourceLocation.ChunkIndex,
                                        sourceLocation.RowIndex,
                                        [&](EntityId movedEntity, NGIN::UIntSize chunkIndex, NGIN::UIntSize rowIndex) {
-                auto& movedSlot = m_slots[GetEntityIndex(movedEntity)];
                 if (movedEntity == entityId)
                 {
                     return;
                 }
-                movedSlot.Location.ChunkIndex = chunkIndex;
-                movedSlot.Location.RowIndex   = rowIndex;
+                SetRowLocation(m_entities.SlotAt(GetEntityIndex(movedEntity)), chunkIndex, rowIndex);
             });
         }
 
     private:
+        // Declared first so it outlives every archetype (and chunk) that returns blocks to it.
+        ChunkPool                                                    m_chunkPool;
         EntityAllocator                                              m_entities;
-        NGIN::Containers::Vector<EntitySlot>                         m_slots;
         NGIN::Containers::Vector<NGIN::Memory::Scoped<Archetype>>    m_archetypes;
         NGIN::Containers::FlatHashMap<ArchetypeSignature, UIntSize>  m_archIndex;
+        NGIN::Containers::Vector<SpawnPack>                          m_spawnPacks;
         NGIN::Containers::FlatHashMap<TypeId, ComponentInfo>         m_componentRegistry;
+
+        // Batch despawn / migration scratch, kept across calls.
+        NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UIntSize>  m_batchGroupOf;
+        NGIN::Containers::Vector<BatchGroup>                         m_batchGroups;
+        NGIN::Containers::Vector<BatchRow>                           m_batchVictims;
+        NGIN::Containers::Vector<NGIN::UIntSize>                     m_batchRows;
+        NGIN::Containers::Vector<EntityId>                           m_batchEntities;
+        NGIN::UIntSize                                               m_defaultChunkBytes {kDefaultChunkBytes};
         NGIN::UInt64                                                 m_currentEpoch {1};
         NGIN::UInt64                                                 m_previousEpoch {0};
+        NGIN::UInt64                                                 m_structureVersion {NextStructureVersion()};
     };
 }// namespace NGIN::ECS
@@ -0,0 +1,157 @@
+#include <NGIN/ECS/ChunkPool.hpp>
+
+#include <new>
+
+namespace NGIN::ECS
+{
+    ChunkPool::~ChunkPool()
+    {
+        Trim();
+    }
+
+    NGIN::UIntSize ChunkPool::SizeClassBytes(NGIN::UIntSize bytes) noexcept
+    {
+        const auto step = bytes > kChunkBlockGranularity ? kChunkBlockGranularity : kChunkAlignment;
+        return bytes == 0 ? kChunkAlignment : (bytes + step - 1) / step * step;
+    }
+
+    NGIN::Containers::Vector<std::byte*>* ChunkPool::FindFreeList(NGIN::UIntSize classBytes) noexcept
+    {
+        for (NGIN::UIntSize index = 0; index < m_classes.Size(); ++index)
+        {
+            if (m_classes[index].Bytes == classBytes)
+            {
+                return &m_classes[index].Blocks;
+            }
+        }
+        return nullptr;
+    }
+
+    NGIN::Containers::Vector<std::byte*>& ChunkPool::FreeListFor(NGIN::UIntSize classBytes)
+    {
+        if (auto* freeList = FindFreeList(classBytes))
+        {
+            return *freeList;
+        }
+        m_classes.EmplaceBack(SizeClass {classBytes, {}});
+        return m_classes[m_classes.Size() - 1].Blocks;
+    }
+
+    std::byte* ChunkPool::Acquire(NGIN::UIntSize bytes)
+    {
+        const auto classBytes = SizeClassBytes(bytes);
+        auto*      freeList   = FindFreeList(classBytes);
+        ++m_stats.Acquired;
+
+        if (freeList && freeList->Size() > 0)
+        {
+            auto* block = (*freeList)[freeList->Size() - 1];
+            freeList->PopBack();
+            ++m_stats.Reused;
+            --m_stats.PooledBlocks;
+            m_stats.PooledBytes -= classBytes;
+            return block;
+        }
+
+        auto* block = static_cast<std::byte*>(m_allocator.Allocate(classBytes, kChunkAlignment));
+        if (!block)
+        {
+            throw std::bad_alloc();
+        }
+        return block;
+    }
+
+    void ChunkPool::Release(std::byte* block, NGIN::UIntSize bytes) noexcept
+    {
+        if (!block)
+        {
+            return;
+        }
+
+        const auto classBytes = SizeClassBytes(bytes);
+        ++m_stats.Released;
+
+        if (m_options.MaxBlocksPerClass == 0 || m_stats.PooledBytes + classBytes > m_options.MaxPooledBytes)
+        {
+            FreeBlock(block, classBytes);
+            return;
+        }
+
+        try
+        {
+            auto& freeList = FreeListFor(classBytes);
+            if (freeList.Size() >= m_options.MaxBlocksPerClass)
+            {
+                FreeBlock(block, classBytes);
+                return;
+            }
+            freeList.PushBack(block);
+        } catch (...)
+        {
+            FreeBlock(block, classBytes);
+            return;
+        }
+        ++m_stats.PooledBlocks;
+        m_stats.PooledBytes += classBytes;
+    }
+
+    void ChunkPool::Trim() noexcept
+    {
+        for (NGIN::UIntSize classIndex = 0; classIndex < m_classes.Size(); ++classIndex)
+        {
+            auto& sizeClass = m_classes[classIndex];
+            for (NGIN::UIntSize index = 0; index < sizeClass.Blocks.Size(); ++index)
+            {
+                FreeBlock(sizeClass.Blocks[index], sizeClass.Bytes);
+            }
+            sizeClass.Blocks.Clear();
+        }
+        m_stats.PooledBlocks = 0;
+        m_stats.PooledBytes  = 0;
+    }
+
+    void ChunkPool::SetOptions(const ChunkPoolOptions& options) noexcept
+    {
+        m_options = options;
+        EnforceHighWaterMarks();
+    }
+
+    void ChunkPool::FreeBlock(std::byte* block, NGIN::UIntSize classBytes) noexcept
+    {
+        m_allocator.Deallocate(block, classBytes, kChunkAlignment);
+        ++m_stats.Freed;
+    }
+
+    void ChunkPool::EnforceHighWaterMarks() noexcept
+    {
+        for (NGIN::UIntSize classIndex = 0; classIndex < m_classes.Size(); ++classIndex)
+        {
+            auto& sizeClass = m_classes[classIndex];
+            while (sizeClass.Blocks.Size() > m_options.MaxBlocksPerClass)
+            {
+                FreeBlock(sizeClass.Blocks[sizeClass.Blocks.Size() - 1], sizeClass.Bytes);
+                sizeClass.Blocks.PopBack();
+                --m_stats.PooledBlocks;
+                m_stats.PooledBytes -= sizeClass.Bytes;
+            }
+        }
+
+        // Over the byte budget, drop from the largest class first; it frees the most memory per block.
+        while (m_stats.PooledBytes > m_options.MaxPooledBytes)
+        {
+            SizeClass* largest = nullptr;
+            for (NGIN::UIntSize classIndex = 0; classIndex < m_classes.Size(); ++classIndex)
+            {
+                auto& sizeClass = m_classes[classIndex];
+                if (sizeClass.Blocks.Size() > 0 && (!largest || sizeClass.Bytes > largest->Bytes))
+                {
+                    largest = &sizeClass;
+                }
+            }
+            FreeBlock(largest->Blocks[largest->Blocks.Size() - 1], largest->Bytes);
+            largest->Blocks.PopBack();
+            --m_stats.PooledBlocks;
+            m_stats.PooledBytes -= largest->Bytes;
+        }
+    }
+}// namespace NGIN::ECS
@@ -1,71 +1,200 @@
 #include <NGIN/ECS/Entity.hpp>
 
+#include <stdexcept>
+
 namespace NGIN::ECS
 {
+    void EntityAllocator::GrowTo(NGIN::UInt64 index)
+    {
+        while (m_slots.Size() <= index)
+        {
+            m_slots.EmplaceBack();
+        }
+    }
+
+    void EntityAllocator::Release(NGIN::UInt64 index)
+    {
+        // Bump generation (wrap permitted)
+        auto& slot      = m_slots[index];
+        slot.Generation = static_cast<NGIN::UInt16>(slot.Generation + 1);
+        slot.State      = EntitySlotState::Free;
+        slot.ClearLocation();
+        m_freeList.PushBack(index);
+        m_freeCursor.store(static_cast<NGIN::Int64>(m_freeList.Size()), std::memory_order_relaxed);
+    }
+
+    void EntityAllocator::Reconcile()
+    {
+        const auto cursor    = m_freeCursor.load(std::memory_order_acquire);
+        const auto unclaimed = cursor > 0 ? static_cast<NGIN::UIntSize>(cursor) : 0;
+        if (unclaimed == m_freeList.Size())
+        {
+            return;
+        }
+        for (NGIN::UIntSize entry = unclaimed; entry < m_freeList.Size(); ++entry)
+        {
+            m_slots[m_freeList[entry]].State = EntitySlotState::Reserved;
+        }
+        while (m_freeList.Size() > unclaimed)
+        {
+            m_freeList.PopBack();
+        }
+        m_freeCursor.store(static_cast<NGIN::Int64>(unclaimed), std::memory_order_relaxed);
+    }
+
     EntityId EntityAllocator::Create()
     {
+        Reconcile();
+
+        NGIN::UInt64 index = 0;
         // Recycle if possible
         if (m_freeList.Size() > 0)
         {
-            const auto freeIdx = m_freeList[m_freeList.Size() - 1];
+            index = m_freeList[m_freeList.Size() - 1];
             m_freeList.PopBack();
-            const auto gen = m_generations[freeIdx];
-            ++m_aliveCount;
-            return MakeEntityId(freeIdx, gen);
+            m_freeCursor.store(static_cast<NGIN::Int64>(m_freeList.Size()), std::memory_order_relaxed);
         }
-        // New index
-        const NGIN::UInt64 index = m_generations.Size();
-        // Start generation at 1 to avoid colliding with NullEntityId (0)
-        m_generations.PushBack(static_cast<NGIN::UInt16>(1));
+        else
+        {
+            index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+            GrowTo(index);
+        }
+        m_slots[index].State = EntitySlotState::Alive;
         ++m_aliveCount;
-        return MakeEntityId(index, 1);
+        return MakeEntityId(index, m_slots[index].Generation);
+    }
+
+    void EntityAllocator::CreateBatch(std::span<EntityId> ids)
+    {
+        Reconcile();
+
+        NGIN::UIntSize item = 0;
+        for (; item < ids.size() && m_freeList.Size() > 0; ++item)
+        {
+            const auto index = m_freeList[m_freeList.Size() - 1];
+            m_freeList.PopBack();
+            m_slots[index].State = EntitySlotState::Alive;
+            ids[item]            = MakeEntityId(index, m_slots[index].Generation);
+        }
+        m_freeCursor.store(static_cast<NGIN::Int64>(m_freeList.Size()), std::memory_order_relaxed);
+
+        const auto fresh = static_cast<NGIN::UInt64>(ids.size() - item);
+        if (fresh > 0)
+        {
+            const auto first = m_nextIndex.fetch_add(fresh, std::memory_order_relaxed);
+            m_slots.Reserve(static_cast<NGIN::UIntSize>(first + fresh));
+            GrowTo(first + fresh - 1);
+            for (NGIN::UInt64 offset = 0; offset < fresh; ++offset, ++item)
+            {
+                auto& slot = m_slots[first + offset];
+                slot.State = EntitySlotState::Alive;
+                ids[item]  = MakeEntityId(first + offset, slot.Generation);
+            }
+        }
+        m_aliveCount += ids.size();
     }
 
     void EntityAllocator::Destroy(EntityId id)
     {
-        if (IsNull(id))
-            return;
-        const auto index = GetEntityIndex(id);
-        if (index >= m_generations.Size())
-            return; // out of range -> ignore
-        const auto currentGen = m_generations[index];
-        if (currentGen != GetEntityGeneration(id))
-            return; // stale id -> ignore
+        if (!IsAlive(id))
+            return; // null, out of range, or stale -> ignore
 
-        // Bump generation (wrap permitted)
-        m_generations[index] = static_cast<NGIN::UInt16>(currentGen + 1);
-        m_freeList.PushBack(index);
+        Reconcile();
+        Release(GetEntityIndex(id));
         if (m_aliveCount > 0)
             --m_aliveCount;
     }
 
-    bool EntityAllocator::IsAlive(EntityId id) const noexcept
+    EntityId EntityAllocator::Reserve() noexcept
+    {
+        // Claim the next free-list entry from the top; once the list is exhausted the cursor just keeps going
+        // negative and Reconcile() clamps it.
+        const auto entry = m_freeCursor.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        if (entry >= 0)
+        {
+            const auto index = m_freeList[static_cast<NGIN::UIntSize>(entry)];
+            return MakeEntityId(index, m_slots[index].Generation);
+        }
+        // Fresh index: the table catches up when it is committed or the next Create() passes it.
+        return MakeEntityId(m_nextIndex.fetch_add(1, std::memory_order_relaxed), 1);
+    }
+
+    bool EntityAllocator::IsReserved(EntityId id) const noexcept
     {
         if (IsNull(id))
             return false;
         const auto index = GetEntityIndex(id);
-        if (index >= m_generations.Size())
+        if (index >= m_slots.Size())
+            return index < m_nextIndex.load(std::memory_order_relaxed) && GetEntityGeneration(id) == 1;
+        const auto& slot = m_slots[index];
+        if (slot.Generation != GetEntityGeneration(id))
+            return false;
+        if (slot.State == EntitySlotState::Reserved)
+            return true;
+        if (slot.State != EntitySlotState::Free)
             return false;
-        return m_generations[index] == GetEntityGeneration(id);
+
+        // Claimed from the free list but not reconciled yet.
+        const auto cursor = m_freeCursor.load(std::memory_order_acquire);
+        for (auto entry = cursor > 0 ? static_cast<NGIN::UIntSize>(cursor) : 0; entry < m_freeList.Size(); ++entry)
+        {
+            if (m_freeList[entry] == index)
+                return true;
+        }
+        return false;
+    }
+
+    void EntityAllocator::Commit(EntityId id)
+    {
+        Reconcile();
+        if (!IsReserved(id))
+        {
+            throw std::logic_error("Entity id is not an outstanding reservation.");
+        }
+        const auto index = GetEntityIndex(id);
+        GrowTo(index);
+        m_slots[index].State = EntitySlotState::Alive;
+        ++m_aliveCount;
+    }
+
+    void EntityAllocator::Cancel(EntityId id)
+    {
+        Reconcile();
+        if (!IsReserved(id))
+            return;
+        const auto index = GetEntityIndex(id);
+        GrowTo(index);
+        Release(index);
     }
 
     void EntityAllocator::Clear() noexcept
     {
+        Reconcile();
         m_freeList.Clear();
-        for (NGIN::UInt64 index = m_generations.Size(); index > 0; --index)
+        for (NGIN::UInt64 index = m_slots.Size(); index > 0; --index)
         {
-            const auto slotIndex = index - 1;
-            m_generations[slotIndex] = static_cast<NGIN::UInt16>(m_generations[slotIndex] + 1);
-            m_freeList.PushBack(slotIndex);
+            auto& slot = m_slots[index - 1];
+            if (slot.State == EntitySlotState::Reserved)
+            {
+                continue;
+            }
+            if (slot.State == EntitySlotState::Alive)
+            {
+                slot.Generation = static_cast<NGIN::UInt16>(slot.Generation + 1);
+                slot.State      = EntitySlotState::Free;
+                slot.ClearLocation();
+            }
+            m_freeList.PushBack(index - 1);
         }
+        m_freeCursor.store(static_cast<NGIN::Int64>(m_freeList.Size()), std::memory_order_relaxed);
         m_aliveCount = 0;
     }
 
     NGIN::UInt16 EntityAllocator::GenerationAtIndex(NGIN::UInt64 index) const noexcept
     {
-        if (index >= m_generations.Size())
+        if (index >= m_slots.Size())
             return 0;
-        return m_generations[index];
+        return m_slots[index].Generation;
     }
 
 } // namespace NGIN::ECS
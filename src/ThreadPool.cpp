@@ -0,0 +1,217 @@
+#include <NGIN/ECS/ThreadPool.hpp>
+
+#include <utility>
+
+namespace NGIN::ECS
+{
+    namespace
+    {
+        /// Pool whose task is running on this thread (null outside any task) and the slot it runs in. The slot is
+        /// only meaningful for that pool, so nesting is detected per pool rather than per thread.
+        thread_local const ThreadPool* t_pool = nullptr;
+        thread_local NGIN::UIntSize    t_slot = 0;
+
+        struct InsideTaskScope
+        {
+            InsideTaskScope(const ThreadPool* pool, NGIN::UIntSize slot) noexcept
+                : m_previousPool(t_pool), m_previousSlot(t_slot)
+            {
+                t_pool = pool;
+                t_slot = slot;
+            }
+
+            ~InsideTaskScope()
+            {
+                t_pool = m_previousPool;
+                t_slot = m_previousSlot;
+            }
+
+            const ThreadPool* m_previousPool;
+            NGIN::UIntSize    m_previousSlot;
+        };
+    }// namespace
+
+    ThreadPool::ThreadPool(NGIN::UIntSize workerCount)
+    {
+        if (workerCount == 0)
+        {
+            const auto hardware = static_cast<NGIN::UIntSize>(std::thread::hardware_concurrency());
+            workerCount         = hardware > 1 ? hardware - 1 : 0;
+        }
+
+        m_ranges = std::make_unique<TaskRange[]>(workerCount + 1);
+        m_workers.reserve(workerCount);
+        for (NGIN::UIntSize worker = 0; worker < workerCount; ++worker)
+        {
+            m_workers.emplace_back([this, slot = worker + 1] { WorkerLoop(slot); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker: m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(NGIN::UIntSize taskCount, const TaskFunction& task)
+    {
+        if (taskCount == 0)
+        {
+            return;
+        }
+
+        // A nested call on this pool keeps its task's slot. A call from a task of another pool runs inline as slot
+        // 0: that thread's slot belongs to the other pool, and dispatching here could deadlock two pools waiting on
+        // each other's workers.
+        if (t_pool != nullptr || m_workers.empty() || taskCount == 1)
+        {
+            const auto      slot = t_pool == this ? t_slot : 0;
+            InsideTaskScope scope {this, slot};
+            for (NGIN::UIntSize index = 0; index < taskCount; ++index)
+            {
+                task(index, slot);
+            }
+            return;
+        }
+
+        std::lock_guard dispatch(m_dispatchMutex);
+
+        const auto participants = Concurrency();
+        const auto share        = taskCount / participants;
+        const auto extra        = taskCount % participants;
+        NGIN::UIntSize begin    = 0;
+        for (NGIN::UIntSize slot = 0; slot < participants; ++slot)
+        {
+            const auto count = share + (slot < extra ? 1 : 0);
+            std::lock_guard rangeLock(m_ranges[slot].Mutex);
+            m_ranges[slot].Begin = begin;
+            m_ranges[slot].End   = begin + count;
+            begin += count;
+        }
+
+        m_task  = &task;
+        m_error = nullptr;
+        {
+            std::lock_guard lock(m_mutex);
+            m_busyWorkers = m_workers.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        {
+            InsideTaskScope scope {this, 0};
+            RunTasks(0);
+        }
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_done.wait(lock, [this] { return m_busyWorkers == 0; });
+        }
+        m_task = nullptr;
+
+        if (m_error)
+        {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+    void ThreadPool::WorkerLoop(NGIN::UIntSize slot)
+    {
+        NGIN::UInt64 seenGeneration = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+                if (m_stopping)
+                {
+                    return;
+                }
+                seenGeneration = m_generation;
+            }
+
+            {
+                InsideTaskScope scope {this, slot};
+                RunTasks(slot);
+            }
+
+            std::lock_guard lock(m_mutex);
+            if (--m_busyWorkers == 0)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::RunTasks(NGIN::UIntSize slot)
+    {
+        do
+        {
+            NGIN::UIntSize taskIndex = 0;
+            while (TakeOwn(slot, taskIndex))
+            {
+                try
+                {
+                    (*m_task)(taskIndex, slot);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(m_errorMutex);
+                    if (!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+            }
+        } while (Steal(slot));
+    }
+
+    bool ThreadPool::TakeOwn(NGIN::UIntSize slot, NGIN::UIntSize& taskIndex)
+    {
+        auto&           range = m_ranges[slot];
+        std::lock_guard lock(range.Mutex);
+        if (range.Begin == range.End)
+        {
+            return false;
+        }
+        taskIndex = range.Begin++;
+        return true;
+    }
+
+    bool ThreadPool::Steal(NGIN::UIntSize slot)
+    {
+        const auto participants = Concurrency();
+        for (NGIN::UIntSize offset = 1; offset < participants; ++offset)
+        {
+            auto& victim = m_ranges[(slot + offset) % participants];
+
+            NGIN::UIntSize stolenBegin = 0;
+            NGIN::UIntSize stolenEnd   = 0;
+            {
+                std::lock_guard lock(victim.Mutex);
+                const auto      available = victim.End - victim.Begin;
+                if (available == 0)
+                {
+                    continue;
+                }
+                stolenEnd   = victim.End;
+                stolenBegin = victim.End - (available + 1) / 2;
+                victim.End  = stolenBegin;
+            }
+
+            auto&           own = m_ranges[slot];
+            std::lock_guard lock(own.Mutex);
+            own.Begin = stolenBegin;
+            own.End   = stolenEnd;
+            return true;
+        }
+        return false;
+    }
+}// namespace NGIN::ECS
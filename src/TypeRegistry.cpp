@@ -0,0 +1,40 @@
+#include <NGIN/ECS/TypeRegistry.hpp>
+
+#include <NGIN/Containers/HashMap.hpp>
+
+#include <mutex>
+
+namespace NGIN::ECS
+{
+    ComponentIndex RegisterComponentIndex(TypeId typeId)
+    {
+        static std::mutex                                            mutex;
+        static NGIN::Containers::FlatHashMap<TypeId, ComponentIndex> indices;
+        static ComponentIndex                                        nextIndex = 0;
+
+        std::lock_guard lock(mutex);
+        if (const auto* existing = indices.GetPtr(typeId))
+        {
+            return *existing;
+        }
+        const auto index = nextIndex++;
+        indices.Insert(typeId, index);
+        return index;
+    }
+
+    NGIN::UInt32 RegisterComponentPackIndex(NGIN::UInt64 packKey)
+    {
+        static std::mutex                                                mutex;
+        static NGIN::Containers::FlatHashMap<NGIN::UInt64, NGIN::UInt32> indices;
+        static NGIN::UInt32                                              nextIndex = 0;
+
+        std::lock_guard lock(mutex);
+        if (const auto* existing = indices.GetPtr(packKey))
+        {
+            return *existing;
+        }
+        const auto index = nextIndex++;
+        indices.Insert(packKey, index);
+        return index;
+    }
+}// namespace NGIN::ECS
@@ -0,0 +1,13 @@
+#include <NGIN/ECS/World.hpp>
+
+#include <atomic>
+
+namespace NGIN::ECS
+{
+    NGIN::UInt64 World::NextStructureVersion() noexcept
+    {
+        // Starts at 1 so a default-constructed QueryState (version 0) never matches a live world.
+        static std::atomic<NGIN::UInt64> nextVersion {1};
+        return nextVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+}// namespace NGIN::ECS
@@ -1,9 +1,10 @@
 /// @file ArchetypeTests.cpp
-/// @brief Signature canonicalization and hashing tests.
+/// @brief Signature canonicalization, hashing, component masks, and transition edge tests.
 
 #include <boost/ut.hpp>
 
 #include <NGIN/ECS/Archetype.hpp>
+#include <NGIN/ECS/World.hpp>
 
 using namespace boost::ut;
 
@@ -31,5 +32,57 @@ suite<"NGIN::ECS::Archetype"> archSuite = [] {
     expect(s1 == s2);
     expect(eq(s1.Hash, s2.Hash));
   };
-};
 
+  "Transition_Edges_Are_Cached_Both_Ways"_test = [] {
+    NGIN::ECS::World world;
+    const auto entity = world.Spawn(C1{1});
+
+    for (int i = 0; i < 4; ++i)
+    {
+        world.Add<Tag>(entity, Tag{});
+        expect(world.Remove<Tag>(entity));
+    }
+
+    expect(eq(world.Archetypes().Size(), 2_u));
+    const auto& base   = *world.Archetypes()[0];
+    const auto& tagged = *world.Archetypes()[1];
+    expect(eq(base.FindAddEdge(NGIN::ECS::GetTypeId<Tag>()), 1_u));
+    expect(eq(tagged.FindRemoveEdge(NGIN::ECS::GetTypeId<Tag>()), 0_u));
+    expect(eq(base.FindRemoveEdge(NGIN::ECS::GetTypeId<Tag>()), NGIN::ECS::kInvalidIndex));
+    expect(world.Get<C1>(entity).x == 1_i);
+  };
+
+  "Component_Mask_Matching_Inline_And_Overflow"_test = [] {
+    NGIN::ECS::ComponentMask archetype;
+    archetype.Set(3);
+    archetype.Set(200);
+    archetype.Set(700);
+
+    NGIN::ECS::ComponentMask required;
+    required.Set(3);
+    required.Set(700);
+    expect(archetype.ContainsAll(required));
+    expect(!required.ContainsAll(archetype));
+
+    NGIN::ECS::ComponentMask beyond;
+    beyond.Set(900);
+    expect(!archetype.ContainsAll(beyond));
+    expect(!archetype.Intersects(beyond));
+
+    NGIN::ECS::ComponentMask excluded;
+    excluded.Set(5);
+    excluded.Set(700);
+    expect(archetype.Intersects(excluded));
+    expect(archetype.Test(700));
+    expect(!archetype.Test(701));
+    expect(NGIN::ECS::ComponentMask {}.Empty());
+    expect(archetype.ContainsAll(NGIN::ECS::ComponentMask {}));
+
+    NGIN::ECS::World world;
+    (void)world.Spawn(C1 {1}, Tag {});
+    const auto& mask = world.Archetypes()[0]->Mask();
+    expect(mask.Test(NGIN::ECS::GetComponentIndex<C1>()));
+    expect(mask.Test(NGIN::ECS::GetComponentIndex<Tag>()));
+    expect(!mask.Test(NGIN::ECS::GetComponentIndex<C2>()));
+  };
+};
@@ -1,5 +1,5 @@
 /// @file ChangeDetectionTests.cpp
-/// @brief Row-granular Added<> and Changed<> query coverage.
+/// @brief Row-granular Added<> and Changed<> query coverage, plus per-chunk tick summaries.
 
 #include <boost/ut.hpp>
 
@@ -18,8 +18,19 @@ namespace
     {
         int value;
     };
+
+    struct UntrackedTransform
+    {
+        float x, y, z;
+    };
 }
 
+template<>
+struct NGIN::ECS::ComponentTraits<UntrackedTransform>
+{
+    static constexpr bool TrackChanges = false;
+};
+
 suite<"NGIN::ECS::ChangeDetection"> changeSuite = [] {
   "Added_Is_RowGranular_For_Mixed_Old_And_New_Rows"_test = [] {
     NGIN::ECS::World world;
@@ -105,4 +116,73 @@ suite<"NGIN::ECS::ChangeDetection"> changeSuite = [] {
     nextFrameQuery.ForEach([&](const NGIN::ECS::RowView&) { ++changedCount; });
     expect(eq(changedCount, 0_u));
   };
+
+  "Chunk_Tick_Summaries_Track_Max_Changed_And_Added"_test = [] {
+    NGIN::ECS::World world {NGIN::ECS::WorldOptions {.ChunkBytes = 1024}};
+    NGIN::Containers::Vector<NGIN::ECS::EntityId> entities;
+    for (int i = 0; i < 128; ++i)
+    {
+        entities.EmplaceBack(world.Spawn(Transform{i}));
+    }
+
+    const auto& archetype = *world.Archetypes()[0];
+    expect(archetype.ChunkCount() > 2_u);
+
+    world.NextEpoch();
+    world.MarkChanged<Transform>(entities[127]);
+
+    NGIN::UIntSize changedChunks = 0;
+    for (NGIN::UIntSize chunkIndex = 0; chunkIndex < archetype.ChunkCount(); ++chunkIndex)
+    {
+        const auto* chunk = archetype.GetChunk(chunkIndex);
+        expect(eq(chunk->MaxAddedTick(0), 1ULL));
+        if (chunk->MaxChangedTick(0) > world.PreviousEpoch())
+        {
+            ++changedChunks;
+        }
+    }
+    expect(eq(changedChunks, 1_u));
+
+    NGIN::UIntSize visitedChunks = 0;
+    NGIN::UIntSize changedRows   = 0;
+    NGIN::ECS::Query<NGIN::ECS::Changed<Transform>> query {world};
+    query.ForChunks([&](const NGIN::ECS::ChunkView& chunk) {
+      ++visitedChunks;
+      changedRows += chunk.Count();
+    });
+    expect(eq(visitedChunks, 1_u));
+    expect(eq(changedRows, 1_u));
+  };
+
+  "Untracked_Component_Skips_Tick_Storage"_test = [] {
+    struct TrackedTransform
+    {
+        float x, y, z;
+    };
+
+    expect(!NGIN::ECS::DescribeComponent<UntrackedTransform>().TrackChanges);
+    expect(NGIN::ECS::DescribeComponent<TrackedTransform>().TrackChanges);
+
+    NGIN::ECS::World world;
+    const auto untracked = world.Spawn(UntrackedTransform{1.0f, 2.0f, 3.0f});
+    (void)world.Spawn(TrackedTransform{1.0f, 2.0f, 3.0f});
+
+    const auto untrackedRows = world.DebugGetChunkRowCapacity<UntrackedTransform>();
+    const auto trackedRows   = world.DebugGetChunkRowCapacity<TrackedTransform>();
+    expect(untrackedRows * 10 > trackedRows * 17) << "untracked rows should be ~1.8x tracked rows";
+
+    world.NextEpoch();
+    world.Set<UntrackedTransform>(untracked, UntrackedTransform{4.0f, 5.0f, 6.0f});
+    world.MarkChanged<UntrackedTransform>(untracked);
+    world.Add<Tag>(untracked, Tag{});
+    expect(world.Get<UntrackedTransform>(untracked).x == 4.0f);
+
+    NGIN::UIntSize seen = 0;
+    NGIN::ECS::Query<NGIN::ECS::Read<UntrackedTransform>, NGIN::ECS::Added<Tag>> query {world};
+    query.ForEach([&](const NGIN::ECS::RowView& row) {
+      ++seen;
+      expect(row.Entity() == untracked);
+    });
+    expect(eq(seen, 1_u));
+  };
 };
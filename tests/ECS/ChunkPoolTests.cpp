@@ -0,0 +1,73 @@
+/// @file ChunkPoolTests.cpp
+/// @brief Chunk block recycling, high-water marks, and trimming.
+
+#include <boost/ut.hpp>
+
+#include <NGIN/ECS/ChunkPool.hpp>
+#include <NGIN/ECS/World.hpp>
+
+using namespace boost::ut;
+
+namespace
+{
+    struct Projectile
+    {
+        float x, y, z;
+    };
+}
+
+suite<"NGIN::ECS::ChunkPool"> chunkPoolSuite = [] {
+  "Despawn_Churn_Reuses_Chunk_Blocks"_test = [] {
+    NGIN::ECS::World world;
+
+    for (int wave = 0; wave < 8; ++wave)
+    {
+        NGIN::Containers::Vector<NGIN::ECS::EntityId> entities;
+        for (int i = 0; i < 16; ++i)
+        {
+            entities.EmplaceBack(world.Spawn(Projectile{float(i), 0.0f, 0.0f}));
+        }
+        for (NGIN::UIntSize i = 0; i < entities.Size(); ++i)
+        {
+            world.Despawn(entities[i]);
+        }
+    }
+
+    const auto& stats = world.GetChunkPool().Stats();
+    expect(eq(stats.Acquired, 8ULL));
+    expect(eq(stats.Reused, 7ULL));
+    expect(eq(stats.Released, 8ULL));
+    expect(eq(stats.PooledBlocks, 1_u));
+    expect(eq(stats.Freed, 0ULL));
+
+    world.GetChunkPool().Trim();
+    expect(eq(world.GetChunkPool().Stats().PooledBlocks, 0_u));
+    expect(eq(world.GetChunkPool().Stats().PooledBytes, 0_u));
+    expect(eq(world.GetChunkPool().Stats().Freed, 1ULL));
+  };
+
+  "High_Water_Marks_Free_Excess_Blocks"_test = [] {
+    NGIN::ECS::ChunkPool pool {NGIN::ECS::ChunkPoolOptions {.MaxBlocksPerClass = 2, .MaxPooledBytes = 1024 * 1024}};
+
+    NGIN::Containers::Vector<std::byte*> blocks;
+    for (int i = 0; i < 4; ++i)
+    {
+        blocks.EmplaceBack(pool.Acquire(3000));
+    }
+    for (NGIN::UIntSize i = 0; i < blocks.Size(); ++i)
+    {
+        pool.Release(blocks[i], 3000);
+    }
+
+    // Small blocks only round up to the alignment; larger ones to the next 4 KiB step.
+    expect(eq(NGIN::ECS::ChunkPool::SizeClassBytes(3000), 3008_u));
+    expect(eq(NGIN::ECS::ChunkPool::SizeClassBytes(256), 256_u));
+    expect(eq(NGIN::ECS::ChunkPool::SizeClassBytes(65 * 1024 + 1), NGIN::UIntSize {68 * 1024}));
+    expect(eq(pool.Stats().PooledBlocks, 2_u));
+    expect(eq(pool.Stats().Freed, 2ULL));
+
+    pool.SetOptions(NGIN::ECS::ChunkPoolOptions {.MaxBlocksPerClass = 2, .MaxPooledBytes = 3008});
+    expect(eq(pool.Stats().PooledBlocks, 1_u));
+    expect(eq(pool.Stats().PooledBytes, 3008_u));
+  };
+};
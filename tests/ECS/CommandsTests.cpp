@@ -7,7 +7,9 @@
 #include <NGIN/ECS/Commands.hpp>
 #include <NGIN/ECS/Query.hpp>
 
+#include <array>
 #include <memory>
+#include <stdexcept>
 
 using namespace boost::ut;
 
@@ -41,6 +43,43 @@ namespace
 
         std::unique_ptr<int> Value;
     };
+
+    struct Counted
+    {
+        static inline int moves = 0;
+
+        Counted() = default;
+        Counted(Counted&&) noexcept
+        {
+            ++moves;
+        }
+        Counted& operator=(Counted&&) noexcept = default;
+        ~Counted() {}
+
+        int value {0};
+    };
+
+    /// Throws from its move constructor while armed and the moved-from value is negative.
+    struct Fragile
+    {
+        static inline bool armed = false;
+
+        explicit Fragile(int input)
+            : value(input)
+        {
+        }
+        Fragile(Fragile&& other)
+            : value(other.value)
+        {
+            if (armed && value < 0)
+            {
+                throw std::runtime_error("fragile component");
+            }
+        }
+        Fragile& operator=(Fragile&&) = default;
+
+        int value;
+    };
 }
 
 suite<"NGIN::ECS::Commands"> commandsSuite = [] {
@@ -103,4 +142,185 @@ suite<"NGIN::ECS::Commands"> commandsSuite = [] {
     query.ForEach([&](const NGIN::ECS::RowView&) { ++tagCount; });
     expect(eq(tagCount, 1_u));
   };
+
+  "Arena_Pages_Survive_Flush_And_Hold_Large_Payloads"_test = [] {
+    NGIN::ECS::World    world;
+    NGIN::ECS::Commands commands;
+
+    for (int index = 0; index < 10000; ++index)
+    {
+        commands.Spawn(Position{index}, Velocity{index * 2});
+    }
+    const auto reserved = commands.ReservedBytes();
+    expect(reserved > NGIN::ECS::Commands::kPageBytes);
+    commands.Flush(world);
+    expect(eq(world.AliveCount(), 10000ULL));
+
+    for (int index = 0; index < 10000; ++index)
+    {
+        commands.Spawn(Position{index}, Velocity{index * 2});
+    }
+    expect(eq(commands.ReservedBytes(), reserved));
+    commands.Clear();
+    expect(eq(commands.Size(), 0_u));
+
+    struct Big
+    {
+        std::array<int, 20000> values;
+    };
+    auto big = std::make_unique<Big>();
+    big->values.back() = 9;
+    commands.Spawn(Tag{});
+    commands.Spawn(std::move(*big));
+    commands.Flush(world);
+    NGIN::UIntSize seen = 0;
+    NGIN::ECS::Query<NGIN::ECS::Read<Big>> query {world};
+    query.ForEach([&](const NGIN::ECS::RowView& row) {
+      ++seen;
+      expect(row.Read<Big>().values.back() == 9_i);
+    });
+    expect(eq(seen, 1_u));
+  };
+
+  "Batched_Flush_Matches_Per_Record_Flush"_test = [] {
+    NGIN::ECS::World    batchedWorld;
+    NGIN::ECS::World    literalWorld;
+    NGIN::ECS::Commands batched;
+    NGIN::ECS::Commands literal;
+    batchedWorld.SetChunkBytes<Position, Velocity>(256);
+    literalWorld.SetChunkBytes<Position, Velocity>(256);
+
+    const auto first = batchedWorld.Spawn(Tag{});
+    (void)literalWorld.Spawn(Tag{});
+    for (auto* commands: {&batched, &literal})
+    {
+        for (int index = 0; index < 100; ++index)
+        {
+            commands->Spawn(Position{index}, Velocity{-index});
+        }
+        commands->Despawn(first);
+        for (int index = 0; index < 3; ++index)
+        {
+            commands->Spawn(Tag{});
+        }
+        commands->Spawn(Position{500}, Velocity{-500});
+    }
+
+    batched.Flush(batchedWorld);
+    literal.Flush(literalWorld, NGIN::ECS::CommandFlushOptions {.BatchConsecutive = false});
+    expect(eq(batched.Size(), 0_u));
+    expect(eq(batchedWorld.AliveCount(), literalWorld.AliveCount()));
+    expect(eq(batchedWorld.AliveCount(), 104ULL));
+
+    NGIN::Containers::Vector<NGIN::ECS::EntityId> batchedIds;
+    NGIN::ECS::Query<NGIN::ECS::Read<Position>, NGIN::ECS::Read<Velocity>> batchedQuery {batchedWorld};
+    batchedQuery.ForEach([&](const NGIN::ECS::RowView& row) {
+      expect(row.Read<Position>().value == -row.Read<Velocity>().value);
+      batchedIds.PushBack(row.Entity());
+    });
+    NGIN::UIntSize index = 0;
+    NGIN::ECS::Query<NGIN::ECS::Read<Position>, NGIN::ECS::Read<Velocity>> literalQuery {literalWorld};
+    literalQuery.ForEach([&](const NGIN::ECS::RowView& row) {
+      expect(index < batchedIds.Size() && row.Entity() == batchedIds[index]);
+      ++index;
+    });
+    expect(eq(index, 101_u));
+    expect(batchedWorld.Get<Position>(batchedIds[100]).value == 500_i);
+  };
+
+  "Coalesced_Flush_Merges_Edits_Per_Entity"_test = [] {
+    NGIN::ECS::World    world;
+    NGIN::ECS::Commands commands;
+
+    const auto moved     = world.Spawn(Position{1}, Counted{});
+    const auto cancelled = world.Spawn(Position{2});
+    const auto doomed    = world.Spawn(Position{3});
+    const auto archetypesBefore = world.Archetypes().Size();
+    Counted::moves = 0;
+
+    commands.Add<Velocity>(moved, Velocity{3});
+    commands.Set<Velocity>(moved, Velocity{4});
+    commands.Add<Tag>(moved, Tag{});
+    commands.Set<Position>(moved, Position{5});
+    commands.Set<Position>(moved, Position{6});
+
+    commands.Add<Velocity>(cancelled, Velocity{7});
+    commands.Remove<Velocity>(cancelled);
+
+    commands.Set<Position>(doomed, Position{8});
+    commands.Add<Tag>(doomed, Tag{});
+    commands.Despawn(doomed);
+
+    commands.Flush(world, NGIN::ECS::CommandFlushOptions {.Coalesce = true});
+
+    expect(eq(Counted::moves, 1));
+    expect(world.Has<Tag>(moved));
+    expect(world.Get<Velocity>(moved).value == 4_i);
+    expect(world.Get<Position>(moved).value == 6_i);
+    expect(!world.Has<Velocity>(cancelled));
+    expect(world.Get<Position>(cancelled).value == 2_i);
+    expect(!world.IsAlive(doomed));
+    // Only the chain {Position, Counted} -> +Velocity -> +Tag was created; the cancelled and doomed edits never ran.
+    expect(eq(world.Archetypes().Size(), archetypesBefore + 2));
+
+    commands.Spawn(Position{9});
+    commands.ClearWorld();
+    commands.Spawn(Tag{});
+    commands.Flush(world, NGIN::ECS::CommandFlushOptions {.Coalesce = true});
+    expect(eq(world.AliveCount(), 1ULL));
+  };
+
+  "Bound_Spawn_Returns_Reserved_Id_Usable_In_Same_Flush"_test = [] {
+    NGIN::ECS::World    world;
+    NGIN::ECS::Commands commands {world};
+
+    const auto parent = commands.Spawn(Position{1});
+    const auto child  = commands.Spawn(Position{2});
+    expect(!NGIN::ECS::IsNull(parent) && parent != child);
+    expect(!world.IsAlive(parent));
+    commands.Add<Velocity>(child, Velocity{static_cast<int>(NGIN::ECS::GetEntityIndex(parent))});
+    commands.Flush(world);
+
+    expect(world.IsAlive(parent) && world.IsAlive(child));
+    expect(world.Get<Position>(parent).value == 1_i);
+    expect(world.Get<Velocity>(child).value == static_cast<int>(NGIN::ECS::GetEntityIndex(parent)));
+
+    const auto dropped = commands.Spawn(Tag{});
+    commands.Clear();
+    expect(!world.IsAlive(dropped));
+    const auto reused = world.Spawn(Tag{});
+    expect(eq(NGIN::ECS::GetEntityIndex(reused), NGIN::ECS::GetEntityIndex(dropped)));
+    expect(reused != dropped);
+
+    NGIN::ECS::World other;
+    (void)commands.Spawn(Tag{});
+    expect(throws<std::logic_error>([&] { commands.Flush(other); }));
+    expect(throws<std::logic_error>([&] { commands.Bind(&other); }));
+  };
+
+  "Throwing_Spawn_Releases_Its_Id"_test = [] {
+    NGIN::ECS::World world;
+    Fragile::armed = true;
+
+    expect(throws<std::runtime_error>([&] { (void)world.Spawn(Fragile{-1}); }));
+    expect(eq(world.AliveCount(), 0ULL));
+
+    NGIN::ECS::Commands commands {world};
+    Fragile::armed    = false;
+    const auto single = commands.Spawn(Fragile{-1});
+    Fragile::armed    = true;
+    expect(throws<std::runtime_error>([&] { commands.Flush(world); }));
+    expect(!world.IsAlive(single));
+    expect(eq(world.AliveCount(), 0ULL));
+
+    Fragile::armed = false;
+    const auto placed = commands.Spawn(Fragile{1});
+    const auto failed = commands.Spawn(Fragile{-2});
+    Fragile::armed    = true;
+    expect(throws<std::runtime_error>([&] { commands.Flush(world); }));
+    expect(world.IsAlive(placed));
+    expect(!world.IsAlive(failed));
+    expect(eq(world.AliveCount(), 1ULL));
+    Fragile::armed = false;
+  };
 };
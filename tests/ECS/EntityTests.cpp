@@ -7,6 +7,10 @@
 #include <NGIN/ECS/World.hpp>
 #include <NGIN/ECS/Query.hpp>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 using namespace boost::ut;
 
 namespace
@@ -16,6 +20,10 @@ namespace
         int value;
     };
 
+    struct Doomed
+    {
+    };
+
     static_assert(!std::is_copy_constructible_v<NGIN::ECS::World>);
     static_assert(!std::is_copy_assignable_v<NGIN::ECS::World>);
 }
@@ -47,6 +55,32 @@ suite<"NGIN::ECS::Entity"> entitySuite = [] {
     expect(!world.IsAlive(e1));
   };
 
+  "Slot_Table_Holds_Generation_State_And_Location"_test = [] {
+    static_assert(sizeof(NGIN::ECS::EntitySlot) == 16);
+    NGIN::ECS::EntityAllocator allocator;
+
+    const auto id   = allocator.Create();
+    auto*      slot = allocator.Find(id);
+    expect(slot != nullptr);
+    expect(slot->State == NGIN::ECS::EntitySlotState::Alive);
+    expect(!slot->HasLocation());
+    slot->ArchetypeIndex = 3;
+    slot->ChunkIndex     = 1;
+    slot->RowIndex       = 7;
+    expect(slot->HasLocation());
+
+    allocator.Destroy(id);
+    expect(allocator.Find(id) == nullptr);
+    const auto& freed = allocator.SlotAt(NGIN::ECS::GetEntityIndex(id));
+    expect(freed.State == NGIN::ECS::EntitySlotState::Free);
+    expect(!freed.HasLocation());
+    expect(eq(static_cast<int>(freed.Generation), 2));
+
+    const auto reused = allocator.Create();
+    expect(allocator.Find(reused) == &allocator.SlotAt(NGIN::ECS::GetEntityIndex(id)));
+    expect(allocator.Find(id) == nullptr);
+  };
+
   "Despawn_Removes_Row_Immediately"_test = [] {
     NGIN::ECS::World world;
 
@@ -71,6 +105,64 @@ suite<"NGIN::ECS::Entity"> entitySuite = [] {
     expect(world.TryGet<Transform>(alive) != nullptr);
   };
 
+  "DespawnBatch_Compacts_Chunks_And_Frees_Emptied_Ones"_test = [] {
+    NGIN::ECS::World world {NGIN::ECS::WorldOptions {.ChunkBytes = 512}};
+    world.Despawn(world.Spawn(Transform{-1}));
+    const auto perChunk = world.DebugGetChunkRowCapacity<Transform>();
+
+    std::vector<NGIN::ECS::EntityId> entities;
+    for (int i = 0; i < static_cast<int>(perChunk * 4); ++i)
+    {
+        entities.push_back(world.Spawn(Transform{i}));
+    }
+    expect(eq(world.DebugGetChunkCount<Transform>(), 4_u));
+
+    // Every row of the first full chunk, every third entity after it, a repeat and a stale id.
+    std::vector<NGIN::ECS::EntityId> victims;
+    for (NGIN::UIntSize i = 0; i < entities.size(); ++i)
+    {
+        if (i < perChunk || i % 3 == 0)
+        {
+            victims.push_back(entities[i]);
+        }
+    }
+    victims.push_back(entities[0]);
+    world.Despawn(entities[0]);
+    world.DespawnBatch(victims);
+
+    NGIN::UIntSize survivors = 0;
+    for (NGIN::UIntSize i = 0; i < entities.size(); ++i)
+    {
+        const bool doomed = i < perChunk || i % 3 == 0;
+        expect(world.IsAlive(entities[i]) == !doomed);
+        if (!doomed)
+        {
+            ++survivors;
+            expect(world.Get<Transform>(entities[i]).value == static_cast<int>(i));
+        }
+    }
+    expect(eq(world.AliveCount(), static_cast<NGIN::UInt64>(survivors)));
+    expect(eq(world.DebugGetChunkCount<Transform>(), 3_u));
+
+    for (NGIN::UIntSize i = 0; i < entities.size(); i += 2)
+    {
+        if (world.IsAlive(entities[i]))
+        {
+            world.Add<Doomed>(entities[i], Doomed{});
+        }
+    }
+    NGIN::ECS::Query<NGIN::ECS::Read<Transform>, NGIN::ECS::With<Doomed>> doomedQuery {world};
+    world.DespawnMatching(doomedQuery);
+    NGIN::UIntSize remaining = 0;
+    NGIN::ECS::Query<NGIN::ECS::Read<Transform>> all {world};
+    all.ForEach([&](const NGIN::ECS::RowView& row) {
+      ++remaining;
+      expect(!world.Has<Doomed>(row.Entity()));
+    });
+    expect(eq(static_cast<NGIN::UInt64>(remaining), world.AliveCount()));
+    expect(eq(world.DebugGetChunkCount<Transform, Doomed>(), 0_u));
+  };
+
   "Clear_Removes_All_Storage"_test = [] {
     NGIN::ECS::World world;
 
@@ -88,4 +180,59 @@ suite<"NGIN::ECS::Entity"> entitySuite = [] {
     expect(eq(world.DebugGetChunkCount<Transform>(), 0_u));
     expect(eq(count, 0_u));
   };
+
+  "Reservations_Are_Unique_Across_Threads_And_Survive_Clear"_test = [] {
+    NGIN::ECS::EntityAllocator allocator;
+    std::vector<NGIN::ECS::EntityId> recycled;
+    for (int index = 0; index < 64; ++index)
+    {
+        recycled.push_back(allocator.Create());
+    }
+    const auto survivor = allocator.Create();
+    for (const auto id: recycled)
+    {
+        allocator.Destroy(id);
+    }
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 500;
+    std::vector<std::vector<NGIN::ECS::EntityId>> reserved(kThreads);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kThreads; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+          for (int index = 0; index < kPerThread; ++index)
+          {
+              reserved[thread].push_back(allocator.Reserve());
+          }
+        });
+    }
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    std::vector<NGIN::ECS::EntityId> all;
+    for (const auto& ids: reserved)
+    {
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+    std::sort(all.begin(), all.end());
+    expect(std::adjacent_find(all.begin(), all.end()) == all.end());
+    expect(std::find_if(all.begin(), all.end(), [](auto id) { return NGIN::ECS::GetEntityIndex(id) == 0; }) != all.end());
+    expect(!allocator.IsAlive(all.front()) && allocator.IsReserved(all.front()));
+    expect(allocator.IsAlive(survivor));
+
+    const auto created = allocator.Create();
+    expect(std::find(all.begin(), all.end(), created) == all.end());
+    allocator.Clear();
+    const auto fresh = allocator.Create();
+    expect(std::find(all.begin(), all.end(), fresh) == all.end());
+    for (const auto id: all)
+    {
+        allocator.Commit(id);
+    }
+    expect(eq(allocator.AliveCount(), static_cast<NGIN::UInt64>(kThreads * kPerThread + 1)));
+    expect(throws<std::logic_error>([&] { allocator.Commit(all.front()); }));
+  };
 };
@@ -19,6 +19,11 @@ namespace
     {
     };
 
+    struct Health
+    {
+        int value;
+    };
+
     struct MoveOnly
     {
         static inline int Alive = 0;
@@ -98,4 +103,51 @@ suite<"NGIN::ECS::Lifecycle"> lifecycleSuite = [] {
 
     expect(eq(MoveOnly::Alive, 0_i));
   };
+
+  "AddToAll_And_RemoveFromAll_Migrate_Matching_Rows_In_Bulk"_test = [] {
+    expect(eq(MoveOnly::Alive, 0_i));
+
+    {
+        NGIN::ECS::World world {NGIN::ECS::WorldOptions {.ChunkBytes = 1024}};
+        std::vector<NGIN::ECS::EntityId> entities;
+        for (int i = 0; i < 200; ++i)
+        {
+            entities.push_back(world.Spawn(Health{i}, std::string(24, static_cast<char>('a' + i % 26)), MoveOnly{i}));
+        }
+        // Tag every third entity so its rows leave holes in otherwise full chunks.
+        for (std::size_t i = 0; i < entities.size(); i += 3)
+        {
+            world.Add<Tag>(entities[i], Tag{});
+        }
+        const auto tagged = (entities.size() + 2) / 3;
+        expect(eq(MoveOnly::Alive, 200_i));
+
+        world.NextEpoch();
+        NGIN::ECS::Query<NGIN::ECS::Read<Health>, NGIN::ECS::Without<Tag>> untagged {world};
+        expect(eq(world.AddToAll<Tag>(untagged, Tag{}), entities.size() - tagged));
+
+        NGIN::ECS::Query<NGIN::ECS::Read<Health>> everyone {world};
+        expect(eq(world.AddToAll<Tag>(everyone, Tag{}), 0_u));
+        expect(eq(world.RemoveFromAll<Health>(everyone), entities.size()));
+        expect(eq(world.RemoveFromAll<Health>(everyone), 0_u));
+
+        for (std::size_t i = 0; i < entities.size(); ++i)
+        {
+            expect(world.Has<Tag>(entities[i]));
+            expect(!world.Has<Health>(entities[i]));
+            expect(world.Get<std::string>(entities[i]) == std::string(24, static_cast<char>('a' + i % 26)));
+            expect(*world.Get<MoveOnly>(entities[i]).Value == static_cast<int>(i));
+        }
+        expect(eq(world.DebugGetChunkCount<Health, std::string, MoveOnly>(), 0_u));
+        expect(eq(world.DebugGetChunkCount<Health, std::string, MoveOnly, Tag>(), 0_u));
+        expect(eq(MoveOnly::Alive, 200_i));
+
+        NGIN::ECS::Query<NGIN::ECS::Read<std::string>, NGIN::ECS::Added<Tag>> recentlyTagged {world, world.PreviousEpoch()};
+        NGIN::UIntSize fresh = 0;
+        recentlyTagged.ForEach([&](const NGIN::ECS::RowView&) { ++fresh; });
+        expect(eq(fresh, entities.size() - tagged));
+    }
+
+    expect(eq(MoveOnly::Alive, 0_i));
+  };
 };
@@ -0,0 +1,119 @@
+/// @file ParallelTests.cpp
+/// @brief Thread pool work distribution and parallel query iteration.
+
+#include <boost/ut.hpp>
+
+#include <NGIN/ECS/Query.hpp>
+#include <NGIN/ECS/ThreadPool.hpp>
+#include <NGIN/ECS/World.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace boost::ut;
+
+namespace
+{
+    struct Position
+    {
+        float x;
+    };
+
+    struct Speed
+    {
+        float value;
+    };
+}
+
+suite<"NGIN::ECS::Parallel"> parallelSuite = [] {
+  "ThreadPool_Runs_Every_Task_Once_And_Rethrows"_test = [] {
+    NGIN::ECS::ThreadPool pool {3};
+    expect(eq(pool.Concurrency(), 4_u));
+
+    std::vector<std::atomic<int>> hits(1000);
+    std::atomic<bool>             slotsInRange {true};
+    pool.ParallelFor(hits.size(), [&](NGIN::UIntSize task, NGIN::UIntSize slot) {
+      hits[task].fetch_add(1);
+      if (slot >= 4)
+      {
+          slotsInRange = false;
+      }
+    });
+
+    bool allOnce = true;
+    for (auto& hit : hits)
+    {
+        allOnce = allOnce && hit.load() == 1;
+    }
+    expect(allOnce);
+    expect(slotsInRange.load());
+
+    NGIN::ECS::ThreadPool narrow {1};
+    std::atomic<int>      nestedRuns {0};
+    std::atomic<bool>     nestedInRange {true};
+    pool.ParallelFor(16, [&](NGIN::UIntSize, NGIN::UIntSize) {
+      narrow.ParallelFor(4, [&](NGIN::UIntSize, NGIN::UIntSize slot) {
+        nestedRuns.fetch_add(1);
+        if (slot >= narrow.Concurrency())
+        {
+            nestedInRange = false;
+        }
+      });
+    });
+    expect(eq(nestedRuns.load(), 64));
+    expect(nestedInRange.load());
+
+    expect(throws<std::runtime_error>([&] {
+      pool.ParallelFor(64, [](NGIN::UIntSize task, NGIN::UIntSize) {
+        if (task == 17)
+        {
+            throw std::runtime_error("task failed");
+        }
+      });
+    }));
+  };
+
+  "ParForEach_Covers_All_Rows_And_Honors_Filters"_test = [] {
+    using namespace NGIN::ECS;
+    World world {WorldOptions {.ChunkBytes = 4096}};
+    NGIN::Containers::Vector<EntityId> entities;
+    for (int i = 0; i < 20000; ++i)
+    {
+        entities.EmplaceBack(world.Spawn(Position {0.0f}, Speed {float(i % 7)}));
+    }
+
+    ThreadPool pool {3};
+    Query<Write<Position>, Read<Speed>> move {world};
+    move.ParForEach(pool, [](const RowView& row) {
+      row.Write<Position>().x += row.Read<Speed>().value + 1.0f;
+    }, 64);
+
+    bool allMoved = true;
+    for (NGIN::UIntSize i = 0; i < entities.Size(); ++i)
+    {
+        allMoved = allMoved && world.Get<Position>(entities[i]).x == float(i % 7) + 1.0f;
+    }
+    expect(allMoved);
+
+    world.NextEpoch();
+    for (NGIN::UIntSize i = 0; i < entities.Size(); i += 10)
+    {
+        world.MarkChanged<Speed>(entities[i]);
+    }
+
+    std::atomic<NGIN::UIntSize> changedRows {0};
+    Query<Changed<Speed>> changed {world};
+    changed.ParForChunks(pool, [&](const ChunkView& chunk) {
+      changedRows.fetch_add(chunk.Count());
+    }, 16);
+    expect(eq(changedRows.load(), NGIN::UIntSize {2000}));
+
+    Query<Write<Position>> marker {world};
+    marker.ParForChunks(pool, [](const ChunkView& chunk) { chunk.MarkColumnChanged<Position>(); }, 16);
+    NGIN::UIntSize marked = 0;
+    Query<Changed<Position>> markedQuery {world};
+    markedQuery.ForEach([&](const RowView&) { ++marked; });
+    expect(eq(marked, entities.Size()));
+  };
+};
@@ -1,11 +1,13 @@
 /// @file QueryBasicTests.cpp
-/// @brief Query iteration, optional terms, and entity-aware access.
+/// @brief Query iteration, optional terms, entity-aware access, typed iteration, column spans, and cached query state.
 
 #include <boost/ut.hpp>
 
 #include <NGIN/ECS/World.hpp>
 #include <NGIN/ECS/Query.hpp>
 
+#include <optional>
+
 using namespace boost::ut;
 
 namespace
@@ -104,4 +106,155 @@ suite<"NGIN::ECS::Query"> querySuite = [] {
     expect(eq(withOptionalVelocity, 1_u));
     expect(eq(withoutOptionalVelocity, 1_u));
   };
+
+  "Query_State_Matches_New_Archetypes_Incrementally"_test = [] {
+    using namespace NGIN::ECS;
+    World world;
+    (void)world.Spawn(Transform{1.0f, 0.0f, 0.0f}, Velocity{});
+    (void)world.Spawn(Velocity{});
+
+    QueryState<Read<Transform>, Opt<Velocity>, Without<Disabled>> state;
+    auto countRows = [&] {
+      NGIN::UIntSize rows = 0;
+      Query<Read<Transform>, Opt<Velocity>, Without<Disabled>> query {world, state};
+      query.ForEach([&](const RowView&) { ++rows; });
+      return rows;
+    };
+
+    expect(eq(countRows(), 1_u));
+    expect(eq(state.MatchCount(), 1_u));
+    expect(eq(state.TermColumns(0)[0], world.Archetypes()[state.ArchetypeIndexAt(0)]->FindColumn(GetComponentIndex<Transform>())));
+    expect(eq(state.TermColumns(0)[2], kInvalidIndex));
+
+    (void)world.Spawn(Transform{2.0f, 0.0f, 0.0f});
+    (void)world.Spawn(Transform{3.0f, 0.0f, 0.0f}, Disabled{});
+    expect(eq(countRows(), 2_u));
+    expect(eq(state.MatchCount(), 2_u));
+    expect(eq(state.TermColumns(1)[1], kInvalidIndex));
+
+    world.Clear();
+    (void)world.Spawn(Transform{4.0f, 0.0f, 0.0f}, PlayerTag{});
+    expect(eq(countRows(), 1_u));
+    expect(eq(state.MatchCount(), 1_u));
+
+    // A new world built at the same address must not inherit the state's matches.
+    std::optional<World> reused;
+    reused.emplace();
+    (void)reused->Spawn(Transform{5.0f, 0.0f, 0.0f}, Velocity{});
+    state.Update(*reused);
+    const auto staleVersion = reused->StructureVersion();
+    reused.reset();
+    reused.emplace();
+    (void)reused->Spawn(Velocity{});
+    expect(reused->StructureVersion() != staleVersion);
+    state.Update(*reused);
+    expect(eq(state.MatchCount(), 0_u));
+  };
+
+  "ChunkView_Column_Spans_And_Bulk_MarkChanged"_test = [] {
+    using namespace NGIN::ECS;
+    World world;
+    NGIN::Containers::Vector<EntityId> entities;
+    for (int i = 0; i < 8; ++i)
+    {
+        entities.EmplaceBack(world.Spawn(Transform{float(i), 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f}));
+    }
+
+    world.NextEpoch();
+    Query<Write<Transform>, Read<Velocity>> query {world};
+    query.ForChunks([&](const ChunkView& chunk) {
+      expect(chunk.IsDense());
+      const auto transforms = chunk.ColumnMut<Transform>();
+      const auto velocities = chunk.Column<Velocity>();
+      const auto ids        = chunk.Entities();
+      expect(eq(transforms.size(), chunk.Count()));
+      expect(eq(ids.size(), chunk.Count()));
+      for (std::size_t row = 0; row < transforms.size(); ++row)
+      {
+          transforms[row].x += velocities[row].vx;
+      }
+      chunk.MarkColumnChanged<Transform>();
+    });
+
+    expect(world.Get<Transform>(entities[3]).x == 4.0f);
+
+    NGIN::UIntSize changed = 0;
+    Query<Changed<Transform>> changedQuery {world, world.PreviousEpoch()};
+    changedQuery.ForEach([&](const RowView&) { ++changed; });
+    expect(eq(changed, entities.Size()));
+
+    world.NextEpoch();
+    world.MarkChanged<Transform>(entities[2]);
+    Query<Changed<Transform>> sparseQuery {world};
+    sparseQuery.ForChunks([&](const ChunkView& chunk) {
+      expect(!chunk.IsDense());
+      expect(throws<std::logic_error>([&] { (void)chunk.Column<Transform>(); }));
+    });
+  };
+
+  "Unfiltered_Query_Uses_Identity_Rows"_test = [] {
+    using namespace NGIN::ECS;
+    static_assert(!Query<Write<Transform>, Opt<Velocity>, Without<Disabled>>::kHasRowFilters);
+    static_assert(Query<Read<Transform>, Changed<Velocity>>::kHasRowFilters);
+
+    World world;
+    NGIN::Containers::Vector<EntityId> entities;
+    for (int i = 0; i < 5; ++i)
+    {
+        entities.EmplaceBack(world.Spawn(Transform{float(i), 0.0f, 0.0f}));
+    }
+
+    Query<Read<Transform>> query {world};
+    query.ForChunks([&](const ChunkView& chunk) {
+      expect(chunk.IsDense());
+      expect(eq(chunk.Count(), entities.Size()));
+      for (NGIN::UIntSize i = 0; i < chunk.Count(); ++i)
+      {
+          expect(chunk.EntityAt(i) == entities[i]);
+          expect(chunk.Row(i).Read<Transform>().x == float(i));
+      }
+    });
+  };
+
+  "ForEachTyped_Passes_Typed_References"_test = [] {
+    using namespace NGIN::ECS;
+    World world;
+    const auto moving   = world.Spawn(Transform{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 2.0f, 3.0f}, PlayerTag{});
+    const auto resting  = world.Spawn(Transform{5.0f, 0.0f, 0.0f}, PlayerTag{});
+    const auto disabled = world.Spawn(Transform{9.0f, 0.0f, 0.0f}, PlayerTag{}, Disabled{});
+    (void)world.Spawn(Transform{7.0f, 0.0f, 0.0f});
+
+    Query<Write<Transform>, Opt<Velocity>, With<PlayerTag>, Without<Disabled>> query {world};
+    NGIN::UIntSize visited = 0;
+    query.ForEachTyped([&](Transform& transform, const Velocity* velocity) {
+      ++visited;
+      if (velocity)
+      {
+          transform.x += velocity->vx;
+      }
+      transform.y = 1.0f;
+    });
+    expect(eq(visited, 2_u));
+    expect(world.Get<Transform>(moving).x == 1.0f);
+    expect(world.Get<Transform>(resting).x == 5.0f);
+    expect(world.Get<Transform>(resting).y == 1.0f);
+    expect(world.Get<Transform>(disabled).y == 0.0f);
+
+    bool sawMoving = false;
+    Query<Read<Transform>, Read<Velocity>> withEntity {world};
+    withEntity.each_typed([&](EntityId entity, const Transform& transform, const Velocity& velocity) {
+      sawMoving = entity == moving && transform.x == 1.0f && velocity.vz == 3.0f;
+    });
+    expect(sawMoving);
+
+    world.NextEpoch();
+    world.MarkChanged<Transform>(resting);
+    NGIN::UIntSize changed = 0;
+    Query<Changed<Transform>, With<PlayerTag>> changedQuery {world};
+    changedQuery.ForEachTyped([&](EntityId entity, const Transform&) {
+      ++changed;
+      expect(entity == resting);
+    });
+    expect(eq(changed, 1_u));
+  };
 };
@@ -1,10 +1,17 @@
 /// @file SchedulerTests.cpp
-/// @brief Typed system params, stage planning, and exclusive execution.
+/// @brief Typed system params, stage planning, exclusive execution, ordering constraints, and parallel dispatch.
 
 #include <boost/ut.hpp>
 
 #include <NGIN/ECS/Scheduler.hpp>
 #include <NGIN/ECS/Query.hpp>
+#include <NGIN/ECS/ThreadPool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 
 using namespace boost::ut;
 
@@ -15,6 +22,11 @@ namespace
         int value;
     };
 
+    struct B
+    {
+        int value;
+    };
+
     struct Tag
     {
     };
@@ -56,7 +68,7 @@ suite<"NGIN::ECS::Scheduler"> schedSuite = [] {
     expect(order[0] == 1_i && order[1] == 2_i);
   };
 
-  "Commands_Param_Forces_Barrier_And_Flush"_test = [] {
+  "Commands_Flush_Before_Dependent_Stages"_test = [] {
     NGIN::ECS::World     world;
     NGIN::ECS::Scheduler scheduler;
 
@@ -74,13 +86,67 @@ suite<"NGIN::ECS::Scheduler"> schedSuite = [] {
     });
 
     scheduler.Register(spawner);
-    scheduler.Register(counter);
+    scheduler.Register(counter.After("Spawner"));
     scheduler.Build();
 
     expect(eq(scheduler.StageCount(), 2_u));
     scheduler.Run(world);
   };
 
+  "Throwing_Run_Discards_Pending_Commands"_test = [] {
+    NGIN::ECS::Scheduler            scheduler;
+    std::optional<NGIN::ECS::World> world;
+    world.emplace();
+
+    NGIN::ECS::EntityId reserved = NGIN::ECS::NullEntityId;
+    scheduler.Register(NGIN::ECS::MakeSystem("Spawner", [&](NGIN::ECS::Commands& commands) {
+      reserved = commands.Spawn(Tag{});
+    }));
+    scheduler.Register(NGIN::ECS::MakeSystem("Thrower", [](NGIN::ECS::Query<NGIN::ECS::Read<A>>&) {
+      throw std::runtime_error("system failed");
+    }));
+    scheduler.Build();
+
+    expect(throws<std::runtime_error>([&] { scheduler.Run(*world); }));
+    expect(!world->IsAlive(reserved));
+    const auto reused = world->Spawn(Tag{});
+    expect(eq(NGIN::ECS::GetEntityIndex(reused), NGIN::ECS::GetEntityIndex(reserved)));
+
+    // The buffers no longer reference the world, so it may go away before the scheduler.
+    world.reset();
+  };
+
+  "Command_Systems_Share_A_Stage_And_Flush_In_Registration_Order"_test = [] {
+    NGIN::ECS::World      world;
+    NGIN::ECS::Scheduler  scheduler;
+    NGIN::ECS::ThreadPool pool {3};
+    scheduler.SetThreadPool(&pool);
+
+    const auto entity = world.Spawn(A{0});
+    scheduler.Register(NGIN::ECS::MakeSystem("SetOne", [&](NGIN::ECS::Commands& commands) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      commands.Set<A>(entity, A{1});
+    }));
+    scheduler.Register(NGIN::ECS::MakeSystem("SetTwo", [&](NGIN::ECS::Commands& commands) {
+      commands.Set<A>(entity, A{2});
+    }));
+    scheduler.Register(NGIN::ECS::MakeSystem("ReadB", [](NGIN::ECS::Query<NGIN::ECS::Read<B>>&) {}));
+    scheduler.Build();
+
+    expect(eq(scheduler.StageCount(), 1_u));
+    expect(eq(scheduler.StageAt(0).size(), 3_u));
+    scheduler.Run(world);
+    expect(world.Get<A>(entity).value == 2_i);
+
+    bool lateRan = false;
+    scheduler.Register(NGIN::ECS::MakeSystem("Late", [&](NGIN::ECS::Commands&) { lateRan = true; }));
+    scheduler.Run(world);
+    expect(!lateRan);
+    scheduler.Build();
+    scheduler.Run(world);
+    expect(lateRan);
+  };
+
   "Exclusive_System_Runs_In_Its_Own_Stage"_test = [] {
     NGIN::ECS::World     world;
     NGIN::ECS::Scheduler scheduler;
@@ -117,4 +183,129 @@ suite<"NGIN::ECS::Scheduler"> schedSuite = [] {
     expect(order.size() == 3_u);
     expect(order[0] == 1_i && order[1] == 2_i && order[2] == 3_i);
   };
+
+  "Thread_Pool_Runs_Stage_Systems_Concurrently"_test = [] {
+    NGIN::ECS::World      world;
+    NGIN::ECS::Scheduler  scheduler;
+    NGIN::ECS::ThreadPool pool {3};
+    scheduler.SetThreadPool(&pool);
+
+    (void)world.Spawn(A{1}, B{1});
+    std::atomic<int> arrived {0};
+    std::atomic<int> overlapped {0};
+    auto rendezvous = [&] {
+      arrived.fetch_add(1);
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (arrived.load() < 2 && std::chrono::steady_clock::now() < deadline)
+      {
+          std::this_thread::yield();
+      }
+      if (arrived.load() >= 2)
+      {
+          overlapped.fetch_add(1);
+      }
+    };
+
+    auto writeA = NGIN::ECS::MakeSystem("WriteA", [&](NGIN::ECS::Query<NGIN::ECS::Write<A>>& query) {
+      rendezvous();
+      query.ForEach([](const NGIN::ECS::RowView& row) { row.Write<A>().value += 1; });
+    });
+    auto writeB = NGIN::ECS::MakeSystem("WriteB", [&](NGIN::ECS::Query<NGIN::ECS::Write<B>>& query) {
+      rendezvous();
+      query.ForEach([](const NGIN::ECS::RowView& row) { row.Write<B>().value += 2; });
+    });
+    auto readBoth = NGIN::ECS::MakeSystem("ReadBoth", [&](NGIN::ECS::Query<NGIN::ECS::Read<A>, NGIN::ECS::Read<B>>& query) {
+      query.ForEach([](const NGIN::ECS::RowView& row) {
+        expect(row.Read<A>().value == 2_i);
+        expect(row.Read<B>().value == 3_i);
+      });
+    });
+
+    scheduler.Register(writeA);
+    scheduler.Register(writeB);
+    scheduler.Register(readBoth);
+    scheduler.Build();
+
+    expect(eq(scheduler.StageCount(), 2_u));
+    expect(eq(scheduler.StageAt(0).size(), 2_u));
+    scheduler.Run(world);
+    expect(eq(overlapped.load(), 2_i));
+  };
+
+  "Explicit_Constraints_Order_Systems_And_Reject_Cycles"_test = [] {
+    NGIN::ECS::World     world;
+    NGIN::ECS::Scheduler scheduler;
+    std::vector<int>     order;
+
+    (void)world.Spawn(A{1}, B{1});
+    scheduler.Register(NGIN::ECS::MakeSystem("Reader", [&](NGIN::ECS::Query<NGIN::ECS::Read<A>>&) { order.push_back(2); }));
+    scheduler.Register(NGIN::ECS::MakeSystem("Writer", [&](NGIN::ECS::Query<NGIN::ECS::Write<A>>&) { order.push_back(1); })
+                           .Before("Reader")
+                           .InSet("Simulation"));
+    scheduler.Register(NGIN::ECS::MakeSystem("Late", [&](NGIN::ECS::Query<NGIN::ECS::Read<B>>&) { order.push_back(3); })
+                           .After("Simulation"));
+    scheduler.Build();
+
+    expect(eq(scheduler.StageCount(), 2_u));
+    expect(scheduler.RunsBefore(1, 0));
+    expect(scheduler.RunsBefore(1, 2));
+    expect(!scheduler.RunsBefore(0, 2) && !scheduler.RunsBefore(2, 0));
+    scheduler.Run(world);
+    expect(order.size() == 3_u);
+    expect(order[0] == 1_i);
+
+    NGIN::ECS::Scheduler cyclic;
+    cyclic.Register(NGIN::ECS::MakeSystem("First", [](NGIN::ECS::Query<NGIN::ECS::Read<A>>&) {}).Before("Second"));
+    cyclic.Register(NGIN::ECS::MakeSystem("Second", [](NGIN::ECS::Query<NGIN::ECS::Read<B>>&) {}).Before("First"));
+    expect(throws<std::logic_error>([&] { cyclic.Build(); }));
+
+    NGIN::ECS::Scheduler unknown;
+    unknown.Register(NGIN::ECS::MakeSystem("Lonely", [](NGIN::ECS::Query<NGIN::ECS::Read<A>>&) {}).After("Missing"));
+    expect(throws<std::logic_error>([&] { unknown.Build(); }));
+  };
+
+  "Build_Prunes_Edges_Implied_By_Longer_Paths"_test = [] {
+    NGIN::ECS::Scheduler scheduler;
+    scheduler.Register(NGIN::ECS::MakeSystem("WriteA", [](NGIN::ECS::Query<NGIN::ECS::Write<A>>&) {}));
+    scheduler.Register(NGIN::ECS::MakeSystem("ReadAWriteB", [](NGIN::ECS::Query<NGIN::ECS::Read<A>, NGIN::ECS::Write<B>>&) {}));
+    scheduler.Register(NGIN::ECS::MakeSystem("ReadBoth", [](NGIN::ECS::Query<NGIN::ECS::Read<A>, NGIN::ECS::Read<B>>&) {}));
+    scheduler.Build();
+
+    // WriteA -> ReadBoth is added before ReadAWriteB -> ReadBoth makes it redundant.
+    expect(scheduler.RunsBefore(0, 2));
+    expect(eq(scheduler.SuccessorsOf(0).size(), 1_u));
+    expect(eq(scheduler.SuccessorsOf(0)[0], 1_u));
+    expect(eq(scheduler.SuccessorsOf(1).size(), 1_u));
+    expect(eq(scheduler.StageCount(), 3_u));
+  };
+
+  "Pooled_Dispatch_Starts_Systems_When_Own_Predecessors_Finish"_test = [] {
+    NGIN::ECS::World      world;
+    NGIN::ECS::Scheduler  scheduler;
+    NGIN::ECS::ThreadPool pool {3};
+    scheduler.SetThreadPool(&pool);
+
+    (void)world.Spawn(A{1}, B{1});
+    std::atomic<bool> followerRan {false};
+    std::atomic<bool> slowSawFollower {false};
+
+    scheduler.Register(NGIN::ECS::MakeSystem("Slow", [&](NGIN::ECS::Query<NGIN::ECS::Write<B>>&) {
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (!followerRan.load() && std::chrono::steady_clock::now() < deadline)
+      {
+          std::this_thread::yield();
+      }
+      slowSawFollower = followerRan.load();
+    }));
+    scheduler.Register(NGIN::ECS::MakeSystem("Leader", [](NGIN::ECS::Query<NGIN::ECS::Write<A>>&) {}));
+    scheduler.Register(NGIN::ECS::MakeSystem("Follower", [&](NGIN::ECS::Query<NGIN::ECS::Read<A>>&) {
+      followerRan = true;
+    }));
+    scheduler.Build();
+
+    // Stage plan would put Follower behind Slow; the graph only makes it wait for Leader.
+    expect(eq(scheduler.StageCount(), 2_u));
+    scheduler.Run(world);
+    expect(slowSawFollower.load());
+  };
 };
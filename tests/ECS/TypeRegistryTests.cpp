@@ -1,8 +1,9 @@
 /// @file TypeRegistryTests.cpp
-/// @brief Tests for component type description and TypeId.
+/// @brief Tests for component type description, TypeId, and dense component indices.
 
 #include <boost/ut.hpp>
 
+#include <NGIN/ECS/Archetype.hpp>
 #include <NGIN/ECS/TypeRegistry.hpp>
 
 using namespace boost::ut;
@@ -55,4 +56,30 @@ suite<"NGIN::ECS::TypeRegistry"> typeSuite = [] {
     expect(tag.IsEmpty);
     expect(eq(tag.Size, sizeof(TagType)));
   };
+
+  "Component_Index_Dense_And_Column_Lookup"_test = [] {
+    using namespace NGIN::ECS;
+    const auto podIndex    = GetComponentIndex<PODType>();
+    const auto nonPodIndex = GetComponentIndex<NonPOD>();
+    expect(podIndex != nonPodIndex);
+    expect(podIndex != kInvalidComponentIndex);
+    expect(eq(GetComponentIndex<PODType>(), podIndex));
+    expect(eq(RegisterComponentIndex(GetTypeId<PODType>()), podIndex));
+    expect(eq(DescribeComponent<NonPOD>().Index, nonPodIndex));
+
+    NGIN::Containers::Vector<TypeId>        signature;
+    NGIN::Containers::Vector<ComponentInfo> components;
+    components.PushBack(DescribeComponent<PODType>());
+    components.PushBack(DescribeComponent<NonPOD>());
+    signature.PushBack(components[0].id);
+    signature.PushBack(components[1].id);
+    Archetype archetype(ArchetypeSignature::FromUnordered(std::move(signature)), std::move(components));
+
+    expect(eq(archetype.FindColumn(podIndex), archetype.FindColumnIndex(GetTypeId<PODType>())));
+    expect(eq(archetype.FindColumn(nonPodIndex), archetype.FindColumnIndex(GetTypeId<NonPOD>())));
+    expect(archetype.Has<PODType>());
+    expect(!archetype.Has<TagType>());
+    expect(eq(archetype.FindColumn(GetComponentIndex<TagType>()), kInvalidIndex));
+    expect(throws<std::out_of_range>([&] { (void)archetype.RequireColumn(GetComponentIndex<TagType>()); }));
+  };
 };
@@ -5,6 +5,12 @@
 
 #include <NGIN/ECS/World.hpp>
 
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
 using namespace boost::ut;
 
 namespace
@@ -12,6 +18,7 @@ namespace
     struct Transform { float x, y, z; };
     struct Velocity { float vx, vy, vz; };
     struct PlayerTag {};
+    struct Name { std::string value; };
 }
 
 suite<"NGIN::ECS::WorldSpawn"> spawnSuite = [] {
@@ -38,4 +45,87 @@ suite<"NGIN::ECS::WorldSpawn"> spawnSuite = [] {
     const auto chunks = world.DebugGetChunkCount<Transform, Velocity, PlayerTag>();
     expect(chunks >= 2_u) << "Expected at least 2 chunks";
   };
+
+  "Argument_Order_Shares_Archetype_And_Cache_Survives_Clear"_test = [] {
+    NGIN::ECS::World world;
+
+    const auto first  = world.Spawn(Transform{1.0f, 2.0f, 3.0f}, Velocity{4.0f, 5.0f, 6.0f});
+    const auto second = world.Spawn(Velocity{7.0f, 8.0f, 9.0f}, Transform{10.0f, 11.0f, 12.0f});
+    expect(eq(world.DebugGetChunkCount<Transform, Velocity>(), 1_u));
+    expect(world.Get<Transform>(first).x == 1.0f && world.Get<Velocity>(first).vz == 6.0f);
+    expect(world.Get<Transform>(second).x == 10.0f && world.Get<Velocity>(second).vx == 7.0f);
+
+    // Clear() drops every archetype; the cached packs must be resolved again.
+    world.Clear();
+    (void)world.Spawn(PlayerTag{});
+    const auto third = world.Spawn(Velocity{1.0f, 0.0f, 0.0f}, Transform{2.0f, 0.0f, 0.0f});
+    expect(world.Get<Transform>(third).x == 2.0f && world.Get<Velocity>(third).vx == 1.0f);
+    expect(!world.Has<PlayerTag>(third));
+  };
+
+  "SpawnBatch_Fills_Chunks_From_Generator_And_Spans"_test = [] {
+    NGIN::ECS::World world {NGIN::ECS::WorldOptions {.ChunkBytes = 1024}};
+    const auto recycled = world.Spawn(Transform{0.0f, 0.0f, 0.0f}, Velocity{0.0f, 0.0f, 0.0f});
+    world.Despawn(recycled);
+
+    const auto generated = world.SpawnBatch<Velocity, Transform>(100, [](NGIN::UIntSize i) {
+      return std::tuple {Velocity{float(i), 0.0f, 0.0f}, Transform{0.0f, float(i), 0.0f}};
+    });
+    expect(eq(generated.Size(), 100_u));
+    expect(eq(NGIN::ECS::GetEntityIndex(generated[0]), NGIN::ECS::GetEntityIndex(recycled)));
+    expect(world.DebugGetChunkCount<Transform, Velocity>() > 1_u);
+    for (NGIN::UIntSize i = 0; i < generated.Size(); ++i)
+    {
+        expect(world.Get<Velocity>(generated[i]).vx == float(i));
+        expect(world.Get<Transform>(generated[i]).y == float(i));
+    }
+
+    std::vector<Transform> transforms;
+    std::vector<Name>      names;
+    for (int i = 0; i < 50; ++i)
+    {
+        transforms.push_back(Transform{float(i), 1.0f, 2.0f});
+        names.push_back(Name{"entity-" + std::to_string(i)});
+    }
+    const auto copied = world.SpawnBatch<Name, Transform>(names, transforms);
+    expect(eq(copied.Size(), 50_u));
+    expect(eq(world.AliveCount(), 150ULL));
+    expect(world.Get<Name>(copied[49]).value == "entity-49");
+    expect(world.Get<Transform>(copied[49]).x == 49.0f);
+    expect(names[49].value == "entity-49");
+
+    expect(throws<std::invalid_argument>([&] {
+      (void)world.SpawnBatch<Name, Transform>(names, std::span<const Transform>(transforms).first(10));
+    }));
+    expect(eq(world.AliveCount(), 150ULL));
+  };
+
+  "Chunk_Bytes_Configurable_Per_World_And_Archetype"_test = [] {
+    NGIN::ECS::World world {NGIN::ECS::WorldOptions {.ChunkBytes = 4 * 1024}};
+    world.SetChunkBytes<Transform>(16 * 1024);
+
+    (void)world.Spawn(Transform{0.0f, 0.0f, 0.0f}, Velocity{1.0f, 0.0f, 0.0f});
+    (void)world.Spawn(Transform{0.0f, 0.0f, 0.0f});
+
+    const auto wide   = world.DebugGetChunkRowCapacity<Transform, Velocity>();
+    const auto narrow = world.DebugGetChunkRowCapacity<Transform>();
+    expect(wide > 0_u);
+    expect(narrow > wide * 2);
+
+    for (NGIN::UIntSize index = 0; index < world.Archetypes().Size(); ++index)
+    {
+        const auto& archetype = *world.Archetypes()[index];
+        for (NGIN::UIntSize chunkIndex = 0; chunkIndex < archetype.ChunkCount(); ++chunkIndex)
+        {
+            const auto* chunk = archetype.GetChunk(chunkIndex);
+            expect(chunk->BlockBytes() <= archetype.ChunkBytes());
+            expect(eq(reinterpret_cast<std::uintptr_t>(chunk->Entities()) % NGIN::ECS::kChunkAlignment, 0_u));
+            for (NGIN::UIntSize column = 0; column < archetype.ComponentCount(); ++column)
+            {
+                const auto address = reinterpret_cast<std::uintptr_t>(chunk->ComponentPtr(column, 0));
+                expect(eq(address % NGIN::ECS::kChunkAlignment, 0_u));
+            }
+        }
+    }
+  };
 };